@@ -0,0 +1,364 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMake/CheckSincos.cmake"
+  "/root/repo/CMake/FindFFTW.cmake"
+  "/root/repo/CMake/GNUCompilers.cmake"
+  "/root/repo/CMake/TestCxx14Library.cmake"
+  "/root/repo/CMake/Testlibstdc++.cmake"
+  "/root/repo/CMake/macros.cmake"
+  "/root/repo/CMake/python.cmake"
+  "/root/repo/CMake/test_labels.cmake"
+  "/root/repo/CMake/unit_test.cmake"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "CMakeFiles/hdf5/cmake_hdf5_test.c"
+  "/root/repo/examples/CMakeLists.txt"
+  "/root/repo/examples/molecules/H2O/CMakeLists.txt"
+  "/root/repo/examples/molecules/He/CMakeLists.txt"
+  "/root/repo/nexus/tests/CMakeLists.txt"
+  "/root/repo/src/CMakeLists.txt"
+  "/root/repo/src/Concurrency/tests/CMakeLists.txt"
+  "/root/repo/src/Containers/CMakeLists.txt"
+  "/root/repo/src/Containers/MinimalContainers/tests/CMakeLists.txt"
+  "/root/repo/src/Containers/OhmmsPETE/tests/CMakeLists.txt"
+  "/root/repo/src/Containers/OhmmsSoA/tests/CMakeLists.txt"
+  "/root/repo/src/Estimators/tests/CMakeLists.txt"
+  "/root/repo/src/Message/CMakeLists.txt"
+  "/root/repo/src/Message/tests/CMakeLists.txt"
+  "/root/repo/src/Numerics/tests/CMakeLists.txt"
+  "/root/repo/src/OhmmsData/tests/CMakeLists.txt"
+  "/root/repo/src/Optimize/tests/CMakeLists.txt"
+  "/root/repo/src/Particle/CMakeLists.txt"
+  "/root/repo/src/Particle/Lattice/tests/CMakeLists.txt"
+  "/root/repo/src/Particle/LongRange/tests/CMakeLists.txt"
+  "/root/repo/src/Particle/ParticleBase/tests/CMakeLists.txt"
+  "/root/repo/src/Particle/ParticleIO/tests/CMakeLists.txt"
+  "/root/repo/src/Particle/tests/CMakeLists.txt"
+  "/root/repo/src/Platforms/CMakeLists.txt"
+  "/root/repo/src/Platforms/CPU/CMakeLists.txt"
+  "/root/repo/src/Platforms/CPU/tests/CMakeLists.txt"
+  "/root/repo/src/Platforms/OpenMP/CMakeLists.txt"
+  "/root/repo/src/Platforms/OpenMP/tests/CMakeLists.txt"
+  "/root/repo/src/QMCApp/CMakeLists.txt"
+  "/root/repo/src/QMCApp/tests/CMakeLists.txt"
+  "/root/repo/src/QMCDrivers/CMakeLists.txt"
+  "/root/repo/src/QMCDrivers/tests/CMakeLists.txt"
+  "/root/repo/src/QMCHamiltonians/CMakeLists.txt"
+  "/root/repo/src/QMCHamiltonians/tests/CMakeLists.txt"
+  "/root/repo/src/QMCTools/CMakeLists.txt"
+  "/root/repo/src/QMCTools/tests/CMakeLists.txt"
+  "/root/repo/src/QMCWaveFunctions/CMakeLists.txt"
+  "/root/repo/src/QMCWaveFunctions/tests/CMakeLists.txt"
+  "/root/repo/src/Utilities/tests/CMakeLists.txt"
+  "/root/repo/src/config.h.cmake.in"
+  "/root/repo/src/einspline/CMakeLists.txt"
+  "/root/repo/src/einspline/tests/CMakeLists.txt"
+  "/root/repo/src/formic/utils/CMakeLists.txt"
+  "/root/repo/src/formic/utils/declare.h.in"
+  "/root/repo/src/formic/utils/mangle.h.in"
+  "/root/repo/src/formic/utils/mpi_interface.cpp.in"
+  "/root/repo/src/formic/utils/mpi_interface.h.in"
+  "/root/repo/src/io/tests/CMakeLists.txt"
+  "/root/repo/src/qmcpack.settings"
+  "/root/repo/src/spline2/tests/CMakeLists.txt"
+  "/root/repo/src/type_traits/tests/CMakeLists.txt"
+  "/root/repo/tests/CMakeLists.txt"
+  "/root/repo/tests/converter/CMakeLists.txt"
+  "/root/repo/tests/estimator/CMakeLists.txt"
+  "/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt"
+  "/root/repo/tests/heg/heg_54_J2rpa/CMakeLists.txt"
+  "/root/repo/tests/io/CMakeLists.txt"
+  "/root/repo/tests/models/CMakeLists.txt"
+  "/root/repo/tests/molecules/C2_pp/CMakeLists.txt"
+  "/root/repo/tests/molecules/CHN_ae/CMakeLists.txt"
+  "/root/repo/tests/molecules/CMakeLists.txt"
+  "/root/repo/tests/molecules/FeCO6_b3lyp_gms/CMakeLists.txt"
+  "/root/repo/tests/molecules/FeCO6_b3lyp_pyscf/CMakeLists.txt"
+  "/root/repo/tests/molecules/H2O_dimer_sep_pp/CMakeLists.txt"
+  "/root/repo/tests/molecules/H2_ae/CMakeLists.txt"
+  "/root/repo/tests/molecules/H4_ae/CMakeLists.txt"
+  "/root/repo/tests/molecules/H4_msd_ae/CMakeLists.txt"
+  "/root/repo/tests/molecules/He_ae/CMakeLists.txt"
+  "/root/repo/tests/molecules/Li2_STO_ae/CMakeLists.txt"
+  "/root/repo/tests/molecules/LiH_ae_MSD/CMakeLists.txt"
+  "/root/repo/tests/molecules/LiH_dimer_ae_gms/CMakeLists.txt"
+  "/root/repo/tests/molecules/LiH_dimer_ae_pyscf/CMakeLists.txt"
+  "/root/repo/tests/molecules/LiH_dimer_ae_qp/CMakeLists.txt"
+  "/root/repo/tests/molecules/LiH_dimer_pp/CMakeLists.txt"
+  "/root/repo/tests/performance/C-graphite/CMakeLists.txt"
+  "/root/repo/tests/performance/C-molecule/CMakeLists.txt"
+  "/root/repo/tests/performance/CMakeLists.txt"
+  "/root/repo/tests/performance/NiO/CMakeLists.txt"
+  "/root/repo/tests/solids/Al-1x1x1-Gaussian_pp_ShiftedTwist/CMakeLists.txt"
+  "/root/repo/tests/solids/CMakeLists.txt"
+  "/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt"
+  "/root/repo/tests/solids/NiO_a4_e48_pp/CMakeLists.txt"
+  "/root/repo/tests/solids/bccH_1x1x1_ae/CMakeLists.txt"
+  "/root/repo/tests/solids/bccH_2x2x2_ae/CMakeLists.txt"
+  "/root/repo/tests/solids/bccH_3x3x3_ae/CMakeLists.txt"
+  "/root/repo/tests/solids/diamondC_1x1x1-Gaussian_pp/CMakeLists.txt"
+  "/root/repo/tests/solids/diamondC_1x1x1-Gaussian_pp_Tw_cplx/CMakeLists.txt"
+  "/root/repo/tests/solids/diamondC_1x1x1-Gaussian_pp_Tw_cplx_MSD/CMakeLists.txt"
+  "/root/repo/tests/solids/diamondC_1x1x1_pp/CMakeLists.txt"
+  "/root/repo/tests/solids/diamondC_2x1x1-Gaussian_pp/CMakeLists.txt"
+  "/root/repo/tests/solids/diamondC_2x1x1-Gaussian_pp_cplx/CMakeLists.txt"
+  "/root/repo/tests/solids/diamondC_2x1x1-Gaussian_pp_cplx_MSD/CMakeLists.txt"
+  "/root/repo/tests/solids/diamondC_2x1x1-Gaussian_pp_kpts/CMakeLists.txt"
+  "/root/repo/tests/solids/diamondC_2x1x1_pp/CMakeLists.txt"
+  "/root/repo/tests/solids/grapheneC_1x1_pp/CMakeLists.txt"
+  "/root/repo/tests/solids/hcpBe_1x1x1_pp/CMakeLists.txt"
+  "/root/repo/tests/solids/monoO_1x1x1_pp/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCheckCompilerFlagCommonPatterns.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDependentOption.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CTest.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestUseLaunchers.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSymbolExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckFunctionExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckSymbolExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckTypeSize.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/DartConfiguration.tcl.in"
+  "/usr/share/cmake-3.25/Modules/FindBLAS.cmake"
+  "/usr/share/cmake-3.25/Modules/FindBoost.cmake"
+  "/usr/share/cmake-3.25/Modules/FindGit.cmake"
+  "/usr/share/cmake-3.25/Modules/FindHDF5.cmake"
+  "/usr/share/cmake-3.25/Modules/FindLAPACK.cmake"
+  "/usr/share/cmake-3.25/Modules/FindLibXml2.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPkgConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPython/Support.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPython3.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/FindZLIB.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckFlagCommonConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/SelectLibraryConfigurations.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "DartConfiguration.tcl"
+  "bin/qmcpack.settings"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/config.h"
+  "src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "nexus/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/einspline/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/Containers/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/Message/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/Platforms/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/Particle/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/QMCWaveFunctions/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/QMCHamiltonians/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/QMCDrivers/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/formic/utils/declare.h"
+  "src/formic/utils/mangle.h"
+  "src/formic/utils/mpi_interface.h"
+  "src/formic/utils/mpi_interface.cpp"
+  "src/formic/utils/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/QMCApp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/QMCTools/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/Numerics/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/Utilities/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/einspline/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/spline2/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/Concurrency/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/OhmmsData/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/io/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/QMCWaveFunctions/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/QMCHamiltonians/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/type_traits/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/Estimators/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/QMCDrivers/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/QMCApp/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/Message/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/Optimize/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/QMCTools/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/Containers/OhmmsPETE/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/Containers/OhmmsSoA/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/Containers/MinimalContainers/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/Platforms/CPU/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/Platforms/OpenMP/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/Platforms/CPU/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/Platforms/OpenMP/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/Particle/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/Particle/Lattice/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/Particle/LongRange/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/Particle/ParticleIO/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/Particle/ParticleBase/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/converter/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/estimator/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/models/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/io/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/performance/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/heg/heg_14_gamma/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/heg/heg_54_J2rpa/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/molecules/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/solids/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/performance/NiO/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/performance/C-graphite/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/performance/C-molecule/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/molecules/Li2_STO_ae/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/molecules/C2_pp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/molecules/LiH_dimer_ae_gms/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/molecules/LiH_dimer_ae_pyscf/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/molecules/LiH_dimer_ae_qp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/molecules/LiH_dimer_pp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/molecules/H2_ae/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/molecules/H4_ae/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/molecules/H4_msd_ae/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/molecules/H2O_dimer_sep_pp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/molecules/FeCO6_b3lyp_gms/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/molecules/FeCO6_b3lyp_pyscf/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/molecules/CHN_ae/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/molecules/LiH_ae_MSD/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/molecules/He_ae/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/solids/LiH_solid_1x1x1_pp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/solids/bccH_3x3x3_ae/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/solids/bccH_2x2x2_ae/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/solids/bccH_1x1x1_ae/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/solids/diamondC_1x1x1_pp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/solids/diamondC_2x1x1_pp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/solids/diamondC_1x1x1-Gaussian_pp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/solids/diamondC_2x1x1-Gaussian_pp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/solids/diamondC_2x1x1-Gaussian_pp_kpts/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/solids/hcpBe_1x1x1_pp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/solids/monoO_1x1x1_pp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/solids/NiO_a4_e48_pp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/solids/grapheneC_1x1_pp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/solids/diamondC_1x1x1-Gaussian_pp_Tw_cplx/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/solids/diamondC_2x1x1-Gaussian_pp_cplx/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/solids/diamondC_2x1x1-Gaussian_pp_cplx_MSD/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/solids/diamondC_1x1x1-Gaussian_pp_Tw_cplx_MSD/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/solids/Al-1x1x1-Gaussian_pp_ShiftedTwist/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/molecules/H2O/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/molecules/He/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/Experimental.dir/DependInfo.cmake"
+  "CMakeFiles/Nightly.dir/DependInfo.cmake"
+  "CMakeFiles/Continuous.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemoryCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyStart.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyBuild.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyTest.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlySubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalStart.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalTest.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousStart.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousTest.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousSubmit.dir/DependInfo.cmake"
+  "src/CMakeFiles/qmcutil.dir/DependInfo.cmake"
+  "src/CMakeFiles/qmcfakerng.dir/DependInfo.cmake"
+  "src/einspline/CMakeFiles/einspline.dir/DependInfo.cmake"
+  "src/Containers/CMakeFiles/containers.dir/DependInfo.cmake"
+  "src/Message/CMakeFiles/message.dir/DependInfo.cmake"
+  "src/Message/CMakeFiles/catch_main.dir/DependInfo.cmake"
+  "src/Platforms/CMakeFiles/platform_host.dir/DependInfo.cmake"
+  "src/Platforms/CMakeFiles/platform_device.dir/DependInfo.cmake"
+  "src/Particle/CMakeFiles/qmcparticle.dir/DependInfo.cmake"
+  "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/DependInfo.cmake"
+  "src/QMCHamiltonians/CMakeFiles/qmcham.dir/DependInfo.cmake"
+  "src/QMCHamiltonians/CMakeFiles/qmcham_unit.dir/DependInfo.cmake"
+  "src/QMCDrivers/CMakeFiles/qmcdriver.dir/DependInfo.cmake"
+  "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/DependInfo.cmake"
+  "src/formic/utils/CMakeFiles/formic_utils.dir/DependInfo.cmake"
+  "src/QMCApp/CMakeFiles/qmc.dir/DependInfo.cmake"
+  "src/QMCApp/CMakeFiles/qmcpack.dir/DependInfo.cmake"
+  "src/QMCTools/CMakeFiles/mocommon.dir/DependInfo.cmake"
+  "src/QMCTools/CMakeFiles/convert4qmc.dir/DependInfo.cmake"
+  "src/QMCTools/CMakeFiles/qmc-extract-eshdf-kvectors.dir/DependInfo.cmake"
+  "src/QMCTools/CMakeFiles/qmc-get-supercell.dir/DependInfo.cmake"
+  "src/QMCTools/CMakeFiles/qmc-check-affinity.dir/DependInfo.cmake"
+  "src/QMCTools/CMakeFiles/convertpw4qmc.dir/DependInfo.cmake"
+  "src/QMCTools/CMakeFiles/fstool.dir/DependInfo.cmake"
+  "src/QMCTools/CMakeFiles/qmcfinitesize.dir/DependInfo.cmake"
+  "src/Numerics/tests/CMakeFiles/test_numerics.dir/DependInfo.cmake"
+  "src/Utilities/tests/CMakeFiles/test_utilities.dir/DependInfo.cmake"
+  "src/einspline/tests/CMakeFiles/test_einspline.dir/DependInfo.cmake"
+  "src/spline2/tests/CMakeFiles/test_spline2.dir/DependInfo.cmake"
+  "src/Concurrency/tests/CMakeFiles/test_Concurrency.dir/DependInfo.cmake"
+  "src/OhmmsData/tests/CMakeFiles/test_ohmmsdata.dir/DependInfo.cmake"
+  "src/io/tests/CMakeFiles/test_io.dir/DependInfo.cmake"
+  "src/QMCWaveFunctions/tests/CMakeFiles/test_wavefunction.dir/DependInfo.cmake"
+  "src/QMCHamiltonians/tests/CMakeFiles/test_hamiltonian.dir/DependInfo.cmake"
+  "src/type_traits/tests/CMakeFiles/test_type_traits.dir/DependInfo.cmake"
+  "src/Estimators/tests/CMakeFiles/test_estimators.dir/DependInfo.cmake"
+  "src/QMCDrivers/tests/CMakeFiles/test_drivers.dir/DependInfo.cmake"
+  "src/QMCDrivers/tests/CMakeFiles/test_new_drivers.dir/DependInfo.cmake"
+  "src/QMCApp/tests/CMakeFiles/test_qmcapp.dir/DependInfo.cmake"
+  "src/Message/tests/CMakeFiles/test_message.dir/DependInfo.cmake"
+  "src/Optimize/tests/CMakeFiles/test_optimize.dir/DependInfo.cmake"
+  "src/QMCTools/tests/CMakeFiles/test_tools.dir/DependInfo.cmake"
+  "src/Containers/OhmmsPETE/tests/CMakeFiles/test_ohmmspete.dir/DependInfo.cmake"
+  "src/Containers/OhmmsSoA/tests/CMakeFiles/test_ohmmssoa.dir/DependInfo.cmake"
+  "src/Containers/MinimalContainers/tests/CMakeFiles/test_MinimalContainers.dir/DependInfo.cmake"
+  "src/Platforms/CPU/CMakeFiles/platform_cpu.dir/DependInfo.cmake"
+  "src/Platforms/OpenMP/CMakeFiles/platform_omp.dir/DependInfo.cmake"
+  "src/Platforms/CPU/tests/CMakeFiles/test_cpu.dir/DependInfo.cmake"
+  "src/Particle/tests/CMakeFiles/test_particle.dir/DependInfo.cmake"
+  "src/Particle/Lattice/tests/CMakeFiles/test_lattice.dir/DependInfo.cmake"
+  "src/Particle/LongRange/tests/CMakeFiles/test_longrange.dir/DependInfo.cmake"
+  "src/Particle/ParticleIO/tests/CMakeFiles/test_particleio.dir/DependInfo.cmake"
+  "src/Particle/ParticleBase/tests/CMakeFiles/test_particle_base.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../lib/libqmcfakerng.a"
+  "../lib/libqmcfakerng.pdb"
+  "CMakeFiles/qmcfakerng.dir/Utilities/FakeRandom.cpp.o"
+  "CMakeFiles/qmcfakerng.dir/Utilities/FakeRandom.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/qmcfakerng.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
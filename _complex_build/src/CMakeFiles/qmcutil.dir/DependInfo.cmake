@@ -0,0 +1,44 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/Message/Communicate.cpp" "src/CMakeFiles/qmcutil.dir/Message/Communicate.cpp.o" "gcc" "src/CMakeFiles/qmcutil.dir/Message/Communicate.cpp.o.d"
+  "/root/repo/src/Message/MPIObjectBase.cpp" "src/CMakeFiles/qmcutil.dir/Message/MPIObjectBase.cpp.o" "gcc" "src/CMakeFiles/qmcutil.dir/Message/MPIObjectBase.cpp.o.d"
+  "/root/repo/src/Numerics/OptimizableFunctorBase.cpp" "src/CMakeFiles/qmcutil.dir/Numerics/OptimizableFunctorBase.cpp.o" "gcc" "src/CMakeFiles/qmcutil.dir/Numerics/OptimizableFunctorBase.cpp.o.d"
+  "/root/repo/src/Numerics/SmoothFunctions.cpp" "src/CMakeFiles/qmcutil.dir/Numerics/SmoothFunctions.cpp.o" "gcc" "src/CMakeFiles/qmcutil.dir/Numerics/SmoothFunctions.cpp.o.d"
+  "/root/repo/src/OhmmsApp/ProjectData.cpp" "src/CMakeFiles/qmcutil.dir/OhmmsApp/ProjectData.cpp.o" "gcc" "src/CMakeFiles/qmcutil.dir/OhmmsApp/ProjectData.cpp.o.d"
+  "/root/repo/src/OhmmsApp/RandomNumberControl.cpp" "src/CMakeFiles/qmcutil.dir/OhmmsApp/RandomNumberControl.cpp.o" "gcc" "src/CMakeFiles/qmcutil.dir/OhmmsApp/RandomNumberControl.cpp.o.d"
+  "/root/repo/src/OhmmsData/Libxml2Doc.cpp" "src/CMakeFiles/qmcutil.dir/OhmmsData/Libxml2Doc.cpp.o" "gcc" "src/CMakeFiles/qmcutil.dir/OhmmsData/Libxml2Doc.cpp.o.d"
+  "/root/repo/src/Optimize/VariableSet.cpp" "src/CMakeFiles/qmcutil.dir/Optimize/VariableSet.cpp.o" "gcc" "src/CMakeFiles/qmcutil.dir/Optimize/VariableSet.cpp.o.d"
+  "/root/repo/src/QMCFactory/OneDimGridFactory.cpp" "src/CMakeFiles/qmcutil.dir/QMCFactory/OneDimGridFactory.cpp.o" "gcc" "src/CMakeFiles/qmcutil.dir/QMCFactory/OneDimGridFactory.cpp.o.d"
+  "/root/repo/src/Utilities/NewTimer.cpp" "src/CMakeFiles/qmcutil.dir/Utilities/NewTimer.cpp.o" "gcc" "src/CMakeFiles/qmcutil.dir/Utilities/NewTimer.cpp.o.d"
+  "/root/repo/src/Utilities/OhmmsObject.cpp" "src/CMakeFiles/qmcutil.dir/Utilities/OhmmsObject.cpp.o" "gcc" "src/CMakeFiles/qmcutil.dir/Utilities/OhmmsObject.cpp.o.d"
+  "/root/repo/src/Utilities/PerfCounters.cpp" "src/CMakeFiles/qmcutil.dir/Utilities/PerfCounters.cpp.o" "gcc" "src/CMakeFiles/qmcutil.dir/Utilities/PerfCounters.cpp.o.d"
+  "/root/repo/src/Utilities/ProgressReportEngine.cpp" "src/CMakeFiles/qmcutil.dir/Utilities/ProgressReportEngine.cpp.o" "gcc" "src/CMakeFiles/qmcutil.dir/Utilities/ProgressReportEngine.cpp.o.d"
+  "/root/repo/src/Utilities/RandomGenerator.cpp" "src/CMakeFiles/qmcutil.dir/Utilities/RandomGenerator.cpp.o" "gcc" "src/CMakeFiles/qmcutil.dir/Utilities/RandomGenerator.cpp.o.d"
+  "/root/repo/src/Utilities/RunTimeManager.cpp" "src/CMakeFiles/qmcutil.dir/Utilities/RunTimeManager.cpp.o" "gcc" "src/CMakeFiles/qmcutil.dir/Utilities/RunTimeManager.cpp.o.d"
+  "/root/repo/src/Utilities/SimpleParser.cpp" "src/CMakeFiles/qmcutil.dir/Utilities/SimpleParser.cpp.o" "gcc" "src/CMakeFiles/qmcutil.dir/Utilities/SimpleParser.cpp.o.d"
+  "/root/repo/src/Utilities/SpeciesSet.cpp" "src/CMakeFiles/qmcutil.dir/Utilities/SpeciesSet.cpp.o" "gcc" "src/CMakeFiles/qmcutil.dir/Utilities/SpeciesSet.cpp.o.d"
+  "/root/repo/src/Utilities/unit_conversion.cpp" "src/CMakeFiles/qmcutil.dir/Utilities/unit_conversion.cpp.o" "gcc" "src/CMakeFiles/qmcutil.dir/Utilities/unit_conversion.cpp.o.d"
+  "/root/repo/src/io/hdf_archive.cpp" "src/CMakeFiles/qmcutil.dir/io/hdf_archive.cpp.o" "gcc" "src/CMakeFiles/qmcutil.dir/io/hdf_archive.cpp.o.d"
+  "/root/repo/src/qmc_common.cpp" "src/CMakeFiles/qmcutil.dir/qmc_common.cpp.o" "gcc" "src/CMakeFiles/qmcutil.dir/qmc_common.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_complex_build/src/Message/CMakeFiles/message.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Containers/CMakeFiles/containers.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/CMakeFiles/platform_device.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/CMakeFiles/platform_host.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/CPU/CMakeFiles/platform_cpu.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/OpenMP/CMakeFiles/platform_omp.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,50 @@
+file(REMOVE_RECURSE
+  "../lib/libqmcutil.a"
+  "../lib/libqmcutil.pdb"
+  "CMakeFiles/qmcutil.dir/Message/Communicate.cpp.o"
+  "CMakeFiles/qmcutil.dir/Message/Communicate.cpp.o.d"
+  "CMakeFiles/qmcutil.dir/Message/MPIObjectBase.cpp.o"
+  "CMakeFiles/qmcutil.dir/Message/MPIObjectBase.cpp.o.d"
+  "CMakeFiles/qmcutil.dir/Numerics/OptimizableFunctorBase.cpp.o"
+  "CMakeFiles/qmcutil.dir/Numerics/OptimizableFunctorBase.cpp.o.d"
+  "CMakeFiles/qmcutil.dir/Numerics/SmoothFunctions.cpp.o"
+  "CMakeFiles/qmcutil.dir/Numerics/SmoothFunctions.cpp.o.d"
+  "CMakeFiles/qmcutil.dir/OhmmsApp/ProjectData.cpp.o"
+  "CMakeFiles/qmcutil.dir/OhmmsApp/ProjectData.cpp.o.d"
+  "CMakeFiles/qmcutil.dir/OhmmsApp/RandomNumberControl.cpp.o"
+  "CMakeFiles/qmcutil.dir/OhmmsApp/RandomNumberControl.cpp.o.d"
+  "CMakeFiles/qmcutil.dir/OhmmsData/Libxml2Doc.cpp.o"
+  "CMakeFiles/qmcutil.dir/OhmmsData/Libxml2Doc.cpp.o.d"
+  "CMakeFiles/qmcutil.dir/Optimize/VariableSet.cpp.o"
+  "CMakeFiles/qmcutil.dir/Optimize/VariableSet.cpp.o.d"
+  "CMakeFiles/qmcutil.dir/QMCFactory/OneDimGridFactory.cpp.o"
+  "CMakeFiles/qmcutil.dir/QMCFactory/OneDimGridFactory.cpp.o.d"
+  "CMakeFiles/qmcutil.dir/Utilities/NewTimer.cpp.o"
+  "CMakeFiles/qmcutil.dir/Utilities/NewTimer.cpp.o.d"
+  "CMakeFiles/qmcutil.dir/Utilities/OhmmsObject.cpp.o"
+  "CMakeFiles/qmcutil.dir/Utilities/OhmmsObject.cpp.o.d"
+  "CMakeFiles/qmcutil.dir/Utilities/PerfCounters.cpp.o"
+  "CMakeFiles/qmcutil.dir/Utilities/PerfCounters.cpp.o.d"
+  "CMakeFiles/qmcutil.dir/Utilities/ProgressReportEngine.cpp.o"
+  "CMakeFiles/qmcutil.dir/Utilities/ProgressReportEngine.cpp.o.d"
+  "CMakeFiles/qmcutil.dir/Utilities/RandomGenerator.cpp.o"
+  "CMakeFiles/qmcutil.dir/Utilities/RandomGenerator.cpp.o.d"
+  "CMakeFiles/qmcutil.dir/Utilities/RunTimeManager.cpp.o"
+  "CMakeFiles/qmcutil.dir/Utilities/RunTimeManager.cpp.o.d"
+  "CMakeFiles/qmcutil.dir/Utilities/SimpleParser.cpp.o"
+  "CMakeFiles/qmcutil.dir/Utilities/SimpleParser.cpp.o.d"
+  "CMakeFiles/qmcutil.dir/Utilities/SpeciesSet.cpp.o"
+  "CMakeFiles/qmcutil.dir/Utilities/SpeciesSet.cpp.o.d"
+  "CMakeFiles/qmcutil.dir/Utilities/unit_conversion.cpp.o"
+  "CMakeFiles/qmcutil.dir/Utilities/unit_conversion.cpp.o.d"
+  "CMakeFiles/qmcutil.dir/io/hdf_archive.cpp.o"
+  "CMakeFiles/qmcutil.dir/io/hdf_archive.cpp.o.d"
+  "CMakeFiles/qmcutil.dir/qmc_common.cpp.o"
+  "CMakeFiles/qmcutil.dir/qmc_common.cpp.o.d"
+  "git-rev-tmp.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/qmcutil.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,33 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src
+# Build directory: /root/repo/_complex_build/src
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("einspline")
+subdirs("Containers")
+subdirs("Message")
+subdirs("Platforms")
+subdirs("Particle")
+subdirs("QMCWaveFunctions")
+subdirs("QMCHamiltonians")
+subdirs("QMCDrivers")
+subdirs("formic/utils")
+subdirs("QMCApp")
+subdirs("QMCTools")
+subdirs("Numerics/tests")
+subdirs("Utilities/tests")
+subdirs("einspline/tests")
+subdirs("spline2/tests")
+subdirs("Concurrency/tests")
+subdirs("OhmmsData/tests")
+subdirs("io/tests")
+subdirs("QMCWaveFunctions/tests")
+subdirs("QMCHamiltonians/tests")
+subdirs("type_traits/tests")
+subdirs("Estimators/tests")
+subdirs("QMCDrivers/tests")
+subdirs("QMCApp/tests")
+subdirs("Message/tests")
+subdirs("Optimize/tests")
+subdirs("QMCTools/tests")
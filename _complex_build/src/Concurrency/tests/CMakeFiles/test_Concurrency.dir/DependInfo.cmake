@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/Concurrency/tests/test_TasksOneToOneOPENMP.cpp" "src/Concurrency/tests/CMakeFiles/test_Concurrency.dir/test_TasksOneToOneOPENMP.cpp.o" "gcc" "src/Concurrency/tests/CMakeFiles/test_Concurrency.dir/test_TasksOneToOneOPENMP.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_complex_build/src/Message/CMakeFiles/catch_main.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Message/CMakeFiles/message.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/CMakeFiles/platform_host.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
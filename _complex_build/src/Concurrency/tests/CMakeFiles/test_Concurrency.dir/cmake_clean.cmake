@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../tests/bin/test_Concurrency"
+  "../../../tests/bin/test_Concurrency.pdb"
+  "CMakeFiles/test_Concurrency.dir/test_TasksOneToOneOPENMP.cpp.o"
+  "CMakeFiles/test_Concurrency.dir/test_TasksOneToOneOPENMP.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_Concurrency.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
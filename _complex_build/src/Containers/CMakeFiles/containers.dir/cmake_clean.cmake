@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../lib/libcontainers.a"
+  "../../lib/libcontainers.pdb"
+  "CMakeFiles/containers.dir/MinimalContainers/ConstantSizeMatrix.cpp.o"
+  "CMakeFiles/containers.dir/MinimalContainers/ConstantSizeMatrix.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/containers.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/Containers
+# Build directory: /root/repo/_complex_build/src/Containers
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("OhmmsPETE/tests")
+subdirs("OhmmsSoA/tests")
+subdirs("MinimalContainers/tests")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../../tests/bin/test_MinimalContainers"
+  "../../../../tests/bin/test_MinimalContainers.pdb"
+  "CMakeFiles/test_MinimalContainers.dir/test_ConstantSizeMatrix.cpp.o"
+  "CMakeFiles/test_MinimalContainers.dir/test_ConstantSizeMatrix.cpp.o.d"
+  "CMakeFiles/test_MinimalContainers.dir/test_RecordArray.cpp.o"
+  "CMakeFiles/test_MinimalContainers.dir/test_RecordArray.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_MinimalContainers.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../../../tests/bin/test_ohmmspete"
+  "../../../../tests/bin/test_ohmmspete.pdb"
+  "CMakeFiles/test_ohmmspete.dir/test_matrix.cpp.o"
+  "CMakeFiles/test_ohmmspete.dir/test_matrix.cpp.o.d"
+  "CMakeFiles/test_ohmmspete.dir/test_tinyvector.cpp.o"
+  "CMakeFiles/test_ohmmspete.dir/test_tinyvector.cpp.o.d"
+  "CMakeFiles/test_ohmmspete.dir/test_vector.cpp.o"
+  "CMakeFiles/test_ohmmspete.dir/test_vector.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_ohmmspete.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
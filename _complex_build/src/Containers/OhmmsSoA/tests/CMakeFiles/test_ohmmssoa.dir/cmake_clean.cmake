@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../tests/bin/test_ohmmssoa"
+  "../../../../tests/bin/test_ohmmssoa.pdb"
+  "CMakeFiles/test_ohmmssoa.dir/test_vector_soa.cpp.o"
+  "CMakeFiles/test_ohmmssoa.dir/test_vector_soa.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_ohmmssoa.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
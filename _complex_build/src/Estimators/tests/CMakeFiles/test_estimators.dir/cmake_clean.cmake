@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "../../../tests/bin/test_estimators"
+  "../../../tests/bin/test_estimators.pdb"
+  "CMakeFiles/test_estimators.dir/test_accumulator.cpp.o"
+  "CMakeFiles/test_estimators.dir/test_accumulator.cpp.o.d"
+  "CMakeFiles/test_estimators.dir/test_local_energy_est.cpp.o"
+  "CMakeFiles/test_estimators.dir/test_local_energy_est.cpp.o.d"
+  "CMakeFiles/test_estimators.dir/test_manager.cpp.o"
+  "CMakeFiles/test_estimators.dir/test_manager.cpp.o.d"
+  "CMakeFiles/test_estimators.dir/test_trace_manager.cpp.o"
+  "CMakeFiles/test_estimators.dir/test_trace_manager.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_estimators.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
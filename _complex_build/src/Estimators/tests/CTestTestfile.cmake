@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/Estimators/tests
+# Build directory: /root/repo/_complex_build/src/Estimators/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(deterministic-unit_test_estimators "/root/repo/_complex_build/tests/bin/test_estimators")
+set_tests_properties(deterministic-unit_test_estimators PROPERTIES  LABELS "quality_unknown;deterministic;unit" _BACKTRACE_TRIPLES "/root/repo/CMake/unit_test.cmake;11;ADD_TEST;/root/repo/src/Estimators/tests/CMakeLists.txt;29;ADD_UNIT_TEST;/root/repo/src/Estimators/tests/CMakeLists.txt;0;")
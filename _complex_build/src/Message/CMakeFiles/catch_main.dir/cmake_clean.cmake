@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../lib/libcatch_main.a"
+  "../../lib/libcatch_main.pdb"
+  "CMakeFiles/catch_main.dir/catch_main.cpp.o"
+  "CMakeFiles/catch_main.dir/catch_main.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/catch_main.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/Message/Communicate.cpp" "src/Message/CMakeFiles/message.dir/Communicate.cpp.o" "gcc" "src/Message/CMakeFiles/message.dir/Communicate.cpp.o.d"
+  "/root/repo/src/Message/MPIObjectBase.cpp" "src/Message/CMakeFiles/message.dir/MPIObjectBase.cpp.o" "gcc" "src/Message/CMakeFiles/message.dir/MPIObjectBase.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_complex_build/src/Platforms/CMakeFiles/platform_host.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
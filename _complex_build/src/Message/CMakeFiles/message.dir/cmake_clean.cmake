@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../lib/libmessage.a"
+  "../../lib/libmessage.pdb"
+  "CMakeFiles/message.dir/Communicate.cpp.o"
+  "CMakeFiles/message.dir/Communicate.cpp.o.d"
+  "CMakeFiles/message.dir/MPIObjectBase.cpp.o"
+  "CMakeFiles/message.dir/MPIObjectBase.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/message.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../tests/bin/test_message"
+  "../../../tests/bin/test_message.pdb"
+  "CMakeFiles/test_message.dir/test_communciate.cpp.o"
+  "CMakeFiles/test_message.dir/test_communciate.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_message.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,36 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/Numerics/tests/test_bessel.cpp" "src/Numerics/tests/CMakeFiles/test_numerics.dir/test_bessel.cpp.o" "gcc" "src/Numerics/tests/CMakeFiles/test_numerics.dir/test_bessel.cpp.o.d"
+  "/root/repo/src/Numerics/tests/test_cartesian_tensor.cpp" "src/Numerics/tests/CMakeFiles/test_numerics.dir/test_cartesian_tensor.cpp.o" "gcc" "src/Numerics/tests/CMakeFiles/test_numerics.dir/test_cartesian_tensor.cpp.o.d"
+  "/root/repo/src/Numerics/tests/test_gaussian_basis.cpp" "src/Numerics/tests/CMakeFiles/test_numerics.dir/test_gaussian_basis.cpp.o" "gcc" "src/Numerics/tests/CMakeFiles/test_numerics.dir/test_gaussian_basis.cpp.o.d"
+  "/root/repo/src/Numerics/tests/test_grid_functor.cpp" "src/Numerics/tests/CMakeFiles/test_numerics.dir/test_grid_functor.cpp.o" "gcc" "src/Numerics/tests/CMakeFiles/test_numerics.dir/test_grid_functor.cpp.o.d"
+  "/root/repo/src/Numerics/tests/test_min_oned.cpp" "src/Numerics/tests/CMakeFiles/test_numerics.dir/test_min_oned.cpp.o" "gcc" "src/Numerics/tests/CMakeFiles/test_numerics.dir/test_min_oned.cpp.o.d"
+  "/root/repo/src/Numerics/tests/test_one_dim_cubic_spline.cpp" "src/Numerics/tests/CMakeFiles/test_numerics.dir/test_one_dim_cubic_spline.cpp.o" "gcc" "src/Numerics/tests/CMakeFiles/test_numerics.dir/test_one_dim_cubic_spline.cpp.o.d"
+  "/root/repo/src/Numerics/tests/test_soa_cartesian_tensor.cpp" "src/Numerics/tests/CMakeFiles/test_numerics.dir/test_soa_cartesian_tensor.cpp.o" "gcc" "src/Numerics/tests/CMakeFiles/test_numerics.dir/test_soa_cartesian_tensor.cpp.o.d"
+  "/root/repo/src/Numerics/tests/test_stdlib.cpp" "src/Numerics/tests/CMakeFiles/test_numerics.dir/test_stdlib.cpp.o" "gcc" "src/Numerics/tests/CMakeFiles/test_numerics.dir/test_stdlib.cpp.o.d"
+  "/root/repo/src/Numerics/tests/test_transform.cpp" "src/Numerics/tests/CMakeFiles/test_numerics.dir/test_transform.cpp.o" "gcc" "src/Numerics/tests/CMakeFiles/test_numerics.dir/test_transform.cpp.o.d"
+  "/root/repo/src/Numerics/tests/test_ylm.cpp" "src/Numerics/tests/CMakeFiles/test_numerics.dir/test_ylm.cpp.o" "gcc" "src/Numerics/tests/CMakeFiles/test_numerics.dir/test_ylm.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_complex_build/src/Message/CMakeFiles/catch_main.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/CMakeFiles/qmcutil.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Containers/CMakeFiles/containers.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/CMakeFiles/platform_device.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Message/CMakeFiles/message.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/CMakeFiles/platform_host.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/CPU/CMakeFiles/platform_cpu.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/OpenMP/CMakeFiles/platform_omp.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
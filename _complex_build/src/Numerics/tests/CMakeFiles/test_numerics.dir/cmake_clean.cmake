@@ -0,0 +1,29 @@
+file(REMOVE_RECURSE
+  "../../../tests/bin/test_numerics"
+  "../../../tests/bin/test_numerics.pdb"
+  "CMakeFiles/test_numerics.dir/test_bessel.cpp.o"
+  "CMakeFiles/test_numerics.dir/test_bessel.cpp.o.d"
+  "CMakeFiles/test_numerics.dir/test_cartesian_tensor.cpp.o"
+  "CMakeFiles/test_numerics.dir/test_cartesian_tensor.cpp.o.d"
+  "CMakeFiles/test_numerics.dir/test_gaussian_basis.cpp.o"
+  "CMakeFiles/test_numerics.dir/test_gaussian_basis.cpp.o.d"
+  "CMakeFiles/test_numerics.dir/test_grid_functor.cpp.o"
+  "CMakeFiles/test_numerics.dir/test_grid_functor.cpp.o.d"
+  "CMakeFiles/test_numerics.dir/test_min_oned.cpp.o"
+  "CMakeFiles/test_numerics.dir/test_min_oned.cpp.o.d"
+  "CMakeFiles/test_numerics.dir/test_one_dim_cubic_spline.cpp.o"
+  "CMakeFiles/test_numerics.dir/test_one_dim_cubic_spline.cpp.o.d"
+  "CMakeFiles/test_numerics.dir/test_soa_cartesian_tensor.cpp.o"
+  "CMakeFiles/test_numerics.dir/test_soa_cartesian_tensor.cpp.o.d"
+  "CMakeFiles/test_numerics.dir/test_stdlib.cpp.o"
+  "CMakeFiles/test_numerics.dir/test_stdlib.cpp.o.d"
+  "CMakeFiles/test_numerics.dir/test_transform.cpp.o"
+  "CMakeFiles/test_numerics.dir/test_transform.cpp.o.d"
+  "CMakeFiles/test_numerics.dir/test_ylm.cpp.o"
+  "CMakeFiles/test_numerics.dir/test_ylm.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_numerics.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
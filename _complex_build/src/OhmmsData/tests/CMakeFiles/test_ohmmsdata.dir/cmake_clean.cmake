@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../tests/bin/test_ohmmsdata"
+  "../../../tests/bin/test_ohmmsdata.pdb"
+  "CMakeFiles/test_ohmmsdata.dir/test_xml.cpp.o"
+  "CMakeFiles/test_ohmmsdata.dir/test_xml.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_ohmmsdata.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
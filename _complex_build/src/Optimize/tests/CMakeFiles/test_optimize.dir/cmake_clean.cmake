@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../tests/bin/test_optimize"
+  "../../../tests/bin/test_optimize.pdb"
+  "CMakeFiles/test_optimize.dir/test_variable_set.cpp.o"
+  "CMakeFiles/test_optimize.dir/test_variable_set.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_optimize.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
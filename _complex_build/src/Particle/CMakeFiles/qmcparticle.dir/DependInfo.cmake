@@ -0,0 +1,54 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/Particle/CoulombPairEnergy.cpp" "src/Particle/CMakeFiles/qmcparticle.dir/CoulombPairEnergy.cpp.o" "gcc" "src/Particle/CMakeFiles/qmcparticle.dir/CoulombPairEnergy.cpp.o.d"
+  "/root/repo/src/Particle/DynamicCoordinatesBuilder.cpp" "src/Particle/CMakeFiles/qmcparticle.dir/DynamicCoordinatesBuilder.cpp.o" "gcc" "src/Particle/CMakeFiles/qmcparticle.dir/DynamicCoordinatesBuilder.cpp.o.d"
+  "/root/repo/src/Particle/HDFWalkerInputManager.cpp" "src/Particle/CMakeFiles/qmcparticle.dir/HDFWalkerInputManager.cpp.o" "gcc" "src/Particle/CMakeFiles/qmcparticle.dir/HDFWalkerInputManager.cpp.o.d"
+  "/root/repo/src/Particle/HDFWalkerInput_0_0.cpp" "src/Particle/CMakeFiles/qmcparticle.dir/HDFWalkerInput_0_0.cpp.o" "gcc" "src/Particle/CMakeFiles/qmcparticle.dir/HDFWalkerInput_0_0.cpp.o.d"
+  "/root/repo/src/Particle/HDFWalkerInput_0_4.cpp" "src/Particle/CMakeFiles/qmcparticle.dir/HDFWalkerInput_0_4.cpp.o" "gcc" "src/Particle/CMakeFiles/qmcparticle.dir/HDFWalkerInput_0_4.cpp.o.d"
+  "/root/repo/src/Particle/HDFWalkerOutput.cpp" "src/Particle/CMakeFiles/qmcparticle.dir/HDFWalkerOutput.cpp.o" "gcc" "src/Particle/CMakeFiles/qmcparticle.dir/HDFWalkerOutput.cpp.o.d"
+  "/root/repo/src/Particle/InitMolecularSystem.cpp" "src/Particle/CMakeFiles/qmcparticle.dir/InitMolecularSystem.cpp.o" "gcc" "src/Particle/CMakeFiles/qmcparticle.dir/InitMolecularSystem.cpp.o.d"
+  "/root/repo/src/Particle/LongRange/EwaldHandler.cpp" "src/Particle/CMakeFiles/qmcparticle.dir/LongRange/EwaldHandler.cpp.o" "gcc" "src/Particle/CMakeFiles/qmcparticle.dir/LongRange/EwaldHandler.cpp.o.d"
+  "/root/repo/src/Particle/LongRange/EwaldHandler3D.cpp" "src/Particle/CMakeFiles/qmcparticle.dir/LongRange/EwaldHandler3D.cpp.o" "gcc" "src/Particle/CMakeFiles/qmcparticle.dir/LongRange/EwaldHandler3D.cpp.o.d"
+  "/root/repo/src/Particle/LongRange/KContainer.cpp" "src/Particle/CMakeFiles/qmcparticle.dir/LongRange/KContainer.cpp.o" "gcc" "src/Particle/CMakeFiles/qmcparticle.dir/LongRange/KContainer.cpp.o.d"
+  "/root/repo/src/Particle/LongRange/LPQHIBasis.cpp" "src/Particle/CMakeFiles/qmcparticle.dir/LongRange/LPQHIBasis.cpp.o" "gcc" "src/Particle/CMakeFiles/qmcparticle.dir/LongRange/LPQHIBasis.cpp.o.d"
+  "/root/repo/src/Particle/LongRange/LPQHISRCoulombBasis.cpp" "src/Particle/CMakeFiles/qmcparticle.dir/LongRange/LPQHISRCoulombBasis.cpp.o" "gcc" "src/Particle/CMakeFiles/qmcparticle.dir/LongRange/LPQHISRCoulombBasis.cpp.o.d"
+  "/root/repo/src/Particle/LongRange/LRBreakupCache.cpp" "src/Particle/CMakeFiles/qmcparticle.dir/LongRange/LRBreakupCache.cpp.o" "gcc" "src/Particle/CMakeFiles/qmcparticle.dir/LongRange/LRBreakupCache.cpp.o.d"
+  "/root/repo/src/Particle/LongRange/LRCoulombSingleton.cpp" "src/Particle/CMakeFiles/qmcparticle.dir/LongRange/LRCoulombSingleton.cpp.o" "gcc" "src/Particle/CMakeFiles/qmcparticle.dir/LongRange/LRCoulombSingleton.cpp.o.d"
+  "/root/repo/src/Particle/LongRange/StructFact.cpp" "src/Particle/CMakeFiles/qmcparticle.dir/LongRange/StructFact.cpp.o" "gcc" "src/Particle/CMakeFiles/qmcparticle.dir/LongRange/StructFact.cpp.o.d"
+  "/root/repo/src/Particle/MCWalkerConfiguration.cpp" "src/Particle/CMakeFiles/qmcparticle.dir/MCWalkerConfiguration.cpp.o" "gcc" "src/Particle/CMakeFiles/qmcparticle.dir/MCWalkerConfiguration.cpp.o.d"
+  "/root/repo/src/Particle/PairHistogram.cpp" "src/Particle/CMakeFiles/qmcparticle.dir/PairHistogram.cpp.o" "gcc" "src/Particle/CMakeFiles/qmcparticle.dir/PairHistogram.cpp.o.d"
+  "/root/repo/src/Particle/ParticleIO/ESHDFParticleParser.cpp" "src/Particle/CMakeFiles/qmcparticle.dir/ParticleIO/ESHDFParticleParser.cpp.o" "gcc" "src/Particle/CMakeFiles/qmcparticle.dir/ParticleIO/ESHDFParticleParser.cpp.o.d"
+  "/root/repo/src/Particle/ParticleIO/ParticleIOUtility.cpp" "src/Particle/CMakeFiles/qmcparticle.dir/ParticleIO/ParticleIOUtility.cpp.o" "gcc" "src/Particle/CMakeFiles/qmcparticle.dir/ParticleIO/ParticleIOUtility.cpp.o.d"
+  "/root/repo/src/Particle/ParticleIO/ParticleLayoutIO.cpp" "src/Particle/CMakeFiles/qmcparticle.dir/ParticleIO/ParticleLayoutIO.cpp.o" "gcc" "src/Particle/CMakeFiles/qmcparticle.dir/ParticleIO/ParticleLayoutIO.cpp.o.d"
+  "/root/repo/src/Particle/ParticleIO/XMLParticleIO.cpp" "src/Particle/CMakeFiles/qmcparticle.dir/ParticleIO/XMLParticleIO.cpp.o" "gcc" "src/Particle/CMakeFiles/qmcparticle.dir/ParticleIO/XMLParticleIO.cpp.o.d"
+  "/root/repo/src/Particle/ParticleSet.BC.cpp" "src/Particle/CMakeFiles/qmcparticle.dir/ParticleSet.BC.cpp.o" "gcc" "src/Particle/CMakeFiles/qmcparticle.dir/ParticleSet.BC.cpp.o.d"
+  "/root/repo/src/Particle/ParticleSet.cpp" "src/Particle/CMakeFiles/qmcparticle.dir/ParticleSet.cpp.o" "gcc" "src/Particle/CMakeFiles/qmcparticle.dir/ParticleSet.cpp.o.d"
+  "/root/repo/src/Particle/ParticleSetPool.cpp" "src/Particle/CMakeFiles/qmcparticle.dir/ParticleSetPool.cpp.o" "gcc" "src/Particle/CMakeFiles/qmcparticle.dir/ParticleSetPool.cpp.o.d"
+  "/root/repo/src/Particle/ParticleTags.cpp" "src/Particle/CMakeFiles/qmcparticle.dir/ParticleTags.cpp.o" "gcc" "src/Particle/CMakeFiles/qmcparticle.dir/ParticleTags.cpp.o.d"
+  "/root/repo/src/Particle/SampleStack.cpp" "src/Particle/CMakeFiles/qmcparticle.dir/SampleStack.cpp.o" "gcc" "src/Particle/CMakeFiles/qmcparticle.dir/SampleStack.cpp.o.d"
+  "/root/repo/src/Particle/VirtualParticleSet.cpp" "src/Particle/CMakeFiles/qmcparticle.dir/VirtualParticleSet.cpp.o" "gcc" "src/Particle/CMakeFiles/qmcparticle.dir/VirtualParticleSet.cpp.o.d"
+  "/root/repo/src/Particle/createDistanceTableAA.cpp" "src/Particle/CMakeFiles/qmcparticle.dir/createDistanceTableAA.cpp.o" "gcc" "src/Particle/CMakeFiles/qmcparticle.dir/createDistanceTableAA.cpp.o.d"
+  "/root/repo/src/Particle/createDistanceTableAB.cpp" "src/Particle/CMakeFiles/qmcparticle.dir/createDistanceTableAB.cpp.o" "gcc" "src/Particle/CMakeFiles/qmcparticle.dir/createDistanceTableAB.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_complex_build/src/CMakeFiles/qmcutil.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/CMakeFiles/platform_device.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Containers/CMakeFiles/containers.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Message/CMakeFiles/message.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/CMakeFiles/platform_host.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/CPU/CMakeFiles/platform_cpu.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/OpenMP/CMakeFiles/platform_omp.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,67 @@
+file(REMOVE_RECURSE
+  "../../lib/libqmcparticle.a"
+  "../../lib/libqmcparticle.pdb"
+  "CMakeFiles/qmcparticle.dir/CoulombPairEnergy.cpp.o"
+  "CMakeFiles/qmcparticle.dir/CoulombPairEnergy.cpp.o.d"
+  "CMakeFiles/qmcparticle.dir/DynamicCoordinatesBuilder.cpp.o"
+  "CMakeFiles/qmcparticle.dir/DynamicCoordinatesBuilder.cpp.o.d"
+  "CMakeFiles/qmcparticle.dir/HDFWalkerInputManager.cpp.o"
+  "CMakeFiles/qmcparticle.dir/HDFWalkerInputManager.cpp.o.d"
+  "CMakeFiles/qmcparticle.dir/HDFWalkerInput_0_0.cpp.o"
+  "CMakeFiles/qmcparticle.dir/HDFWalkerInput_0_0.cpp.o.d"
+  "CMakeFiles/qmcparticle.dir/HDFWalkerInput_0_4.cpp.o"
+  "CMakeFiles/qmcparticle.dir/HDFWalkerInput_0_4.cpp.o.d"
+  "CMakeFiles/qmcparticle.dir/HDFWalkerOutput.cpp.o"
+  "CMakeFiles/qmcparticle.dir/HDFWalkerOutput.cpp.o.d"
+  "CMakeFiles/qmcparticle.dir/InitMolecularSystem.cpp.o"
+  "CMakeFiles/qmcparticle.dir/InitMolecularSystem.cpp.o.d"
+  "CMakeFiles/qmcparticle.dir/LongRange/EwaldHandler.cpp.o"
+  "CMakeFiles/qmcparticle.dir/LongRange/EwaldHandler.cpp.o.d"
+  "CMakeFiles/qmcparticle.dir/LongRange/EwaldHandler3D.cpp.o"
+  "CMakeFiles/qmcparticle.dir/LongRange/EwaldHandler3D.cpp.o.d"
+  "CMakeFiles/qmcparticle.dir/LongRange/KContainer.cpp.o"
+  "CMakeFiles/qmcparticle.dir/LongRange/KContainer.cpp.o.d"
+  "CMakeFiles/qmcparticle.dir/LongRange/LPQHIBasis.cpp.o"
+  "CMakeFiles/qmcparticle.dir/LongRange/LPQHIBasis.cpp.o.d"
+  "CMakeFiles/qmcparticle.dir/LongRange/LPQHISRCoulombBasis.cpp.o"
+  "CMakeFiles/qmcparticle.dir/LongRange/LPQHISRCoulombBasis.cpp.o.d"
+  "CMakeFiles/qmcparticle.dir/LongRange/LRBreakupCache.cpp.o"
+  "CMakeFiles/qmcparticle.dir/LongRange/LRBreakupCache.cpp.o.d"
+  "CMakeFiles/qmcparticle.dir/LongRange/LRCoulombSingleton.cpp.o"
+  "CMakeFiles/qmcparticle.dir/LongRange/LRCoulombSingleton.cpp.o.d"
+  "CMakeFiles/qmcparticle.dir/LongRange/StructFact.cpp.o"
+  "CMakeFiles/qmcparticle.dir/LongRange/StructFact.cpp.o.d"
+  "CMakeFiles/qmcparticle.dir/MCWalkerConfiguration.cpp.o"
+  "CMakeFiles/qmcparticle.dir/MCWalkerConfiguration.cpp.o.d"
+  "CMakeFiles/qmcparticle.dir/PairHistogram.cpp.o"
+  "CMakeFiles/qmcparticle.dir/PairHistogram.cpp.o.d"
+  "CMakeFiles/qmcparticle.dir/ParticleIO/ESHDFParticleParser.cpp.o"
+  "CMakeFiles/qmcparticle.dir/ParticleIO/ESHDFParticleParser.cpp.o.d"
+  "CMakeFiles/qmcparticle.dir/ParticleIO/ParticleIOUtility.cpp.o"
+  "CMakeFiles/qmcparticle.dir/ParticleIO/ParticleIOUtility.cpp.o.d"
+  "CMakeFiles/qmcparticle.dir/ParticleIO/ParticleLayoutIO.cpp.o"
+  "CMakeFiles/qmcparticle.dir/ParticleIO/ParticleLayoutIO.cpp.o.d"
+  "CMakeFiles/qmcparticle.dir/ParticleIO/XMLParticleIO.cpp.o"
+  "CMakeFiles/qmcparticle.dir/ParticleIO/XMLParticleIO.cpp.o.d"
+  "CMakeFiles/qmcparticle.dir/ParticleSet.BC.cpp.o"
+  "CMakeFiles/qmcparticle.dir/ParticleSet.BC.cpp.o.d"
+  "CMakeFiles/qmcparticle.dir/ParticleSet.cpp.o"
+  "CMakeFiles/qmcparticle.dir/ParticleSet.cpp.o.d"
+  "CMakeFiles/qmcparticle.dir/ParticleSetPool.cpp.o"
+  "CMakeFiles/qmcparticle.dir/ParticleSetPool.cpp.o.d"
+  "CMakeFiles/qmcparticle.dir/ParticleTags.cpp.o"
+  "CMakeFiles/qmcparticle.dir/ParticleTags.cpp.o.d"
+  "CMakeFiles/qmcparticle.dir/SampleStack.cpp.o"
+  "CMakeFiles/qmcparticle.dir/SampleStack.cpp.o.d"
+  "CMakeFiles/qmcparticle.dir/VirtualParticleSet.cpp.o"
+  "CMakeFiles/qmcparticle.dir/VirtualParticleSet.cpp.o.d"
+  "CMakeFiles/qmcparticle.dir/createDistanceTableAA.cpp.o"
+  "CMakeFiles/qmcparticle.dir/createDistanceTableAA.cpp.o.d"
+  "CMakeFiles/qmcparticle.dir/createDistanceTableAB.cpp.o"
+  "CMakeFiles/qmcparticle.dir/createDistanceTableAB.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/qmcparticle.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/Particle
+# Build directory: /root/repo/_complex_build/src/Particle
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("tests")
+subdirs("Lattice/tests")
+subdirs("LongRange/tests")
+subdirs("ParticleIO/tests")
+subdirs("ParticleBase/tests")
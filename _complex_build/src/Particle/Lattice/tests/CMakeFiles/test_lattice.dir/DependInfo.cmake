@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/Particle/Lattice/tests/test_CrystalLattice.cpp" "src/Particle/Lattice/tests/CMakeFiles/test_lattice.dir/test_CrystalLattice.cpp.o" "gcc" "src/Particle/Lattice/tests/CMakeFiles/test_lattice.dir/test_CrystalLattice.cpp.o.d"
+  "/root/repo/src/Particle/Lattice/tests/test_LRBreakupParameters.cpp" "src/Particle/Lattice/tests/CMakeFiles/test_lattice.dir/test_LRBreakupParameters.cpp.o" "gcc" "src/Particle/Lattice/tests/CMakeFiles/test_lattice.dir/test_LRBreakupParameters.cpp.o.d"
+  "/root/repo/src/Particle/Lattice/tests/test_ParticleBConds.cpp" "src/Particle/Lattice/tests/CMakeFiles/test_lattice.dir/test_ParticleBConds.cpp.o" "gcc" "src/Particle/Lattice/tests/CMakeFiles/test_lattice.dir/test_ParticleBConds.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_complex_build/src/Message/CMakeFiles/catch_main.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/CMakeFiles/qmcutil.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Containers/CMakeFiles/containers.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/CMakeFiles/platform_device.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Message/CMakeFiles/message.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/CMakeFiles/platform_host.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/CPU/CMakeFiles/platform_cpu.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/OpenMP/CMakeFiles/platform_omp.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
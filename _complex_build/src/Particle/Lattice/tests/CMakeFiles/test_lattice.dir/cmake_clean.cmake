@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../../../tests/bin/test_lattice"
+  "../../../../tests/bin/test_lattice.pdb"
+  "CMakeFiles/test_lattice.dir/test_CrystalLattice.cpp.o"
+  "CMakeFiles/test_lattice.dir/test_CrystalLattice.cpp.o.d"
+  "CMakeFiles/test_lattice.dir/test_LRBreakupParameters.cpp.o"
+  "CMakeFiles/test_lattice.dir/test_LRBreakupParameters.cpp.o.d"
+  "CMakeFiles/test_lattice.dir/test_ParticleBConds.cpp.o"
+  "CMakeFiles/test_lattice.dir/test_ParticleBConds.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_lattice.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
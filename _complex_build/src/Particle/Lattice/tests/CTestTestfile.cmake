@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/Particle/Lattice/tests
+# Build directory: /root/repo/_complex_build/src/Particle/Lattice/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(deterministic-unit_test_lattice "/root/repo/_complex_build/tests/bin/test_lattice")
+set_tests_properties(deterministic-unit_test_lattice PROPERTIES  LABELS "quality_unknown;deterministic;unit" _BACKTRACE_TRIPLES "/root/repo/CMake/unit_test.cmake;11;ADD_TEST;/root/repo/src/Particle/Lattice/tests/CMakeLists.txt;25;ADD_UNIT_TEST;/root/repo/src/Particle/Lattice/tests/CMakeLists.txt;0;")
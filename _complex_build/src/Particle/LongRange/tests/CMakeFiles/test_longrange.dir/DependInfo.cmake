@@ -0,0 +1,32 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/Particle/LongRange/tests/test_ewald3d.cpp" "src/Particle/LongRange/tests/CMakeFiles/test_longrange.dir/test_ewald3d.cpp.o" "gcc" "src/Particle/LongRange/tests/CMakeFiles/test_longrange.dir/test_ewald3d.cpp.o.d"
+  "/root/repo/src/Particle/LongRange/tests/test_lrhandler.cpp" "src/Particle/LongRange/tests/CMakeFiles/test_longrange.dir/test_lrhandler.cpp.o" "gcc" "src/Particle/LongRange/tests/CMakeFiles/test_longrange.dir/test_lrhandler.cpp.o.d"
+  "/root/repo/src/Particle/LongRange/tests/test_srcoul.cpp" "src/Particle/LongRange/tests/CMakeFiles/test_longrange.dir/test_srcoul.cpp.o" "gcc" "src/Particle/LongRange/tests/CMakeFiles/test_longrange.dir/test_srcoul.cpp.o.d"
+  "/root/repo/src/Particle/LongRange/tests/test_srtable.cpp" "src/Particle/LongRange/tests/CMakeFiles/test_longrange.dir/test_srtable.cpp.o" "gcc" "src/Particle/LongRange/tests/CMakeFiles/test_longrange.dir/test_srtable.cpp.o.d"
+  "/root/repo/src/Particle/LongRange/tests/test_temp.cpp" "src/Particle/LongRange/tests/CMakeFiles/test_longrange.dir/test_temp.cpp.o" "gcc" "src/Particle/LongRange/tests/CMakeFiles/test_longrange.dir/test_temp.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_complex_build/src/Message/CMakeFiles/catch_main.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Particle/CMakeFiles/qmcparticle.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/CMakeFiles/qmcutil.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Containers/CMakeFiles/containers.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/CMakeFiles/platform_device.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Message/CMakeFiles/message.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/CMakeFiles/platform_host.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/CPU/CMakeFiles/platform_cpu.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/OpenMP/CMakeFiles/platform_omp.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
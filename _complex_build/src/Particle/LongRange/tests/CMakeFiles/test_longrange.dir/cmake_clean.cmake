@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "../../../../tests/bin/test_longrange"
+  "../../../../tests/bin/test_longrange.pdb"
+  "CMakeFiles/test_longrange.dir/test_ewald3d.cpp.o"
+  "CMakeFiles/test_longrange.dir/test_ewald3d.cpp.o.d"
+  "CMakeFiles/test_longrange.dir/test_lrhandler.cpp.o"
+  "CMakeFiles/test_longrange.dir/test_lrhandler.cpp.o.d"
+  "CMakeFiles/test_longrange.dir/test_srcoul.cpp.o"
+  "CMakeFiles/test_longrange.dir/test_srcoul.cpp.o.d"
+  "CMakeFiles/test_longrange.dir/test_srtable.cpp.o"
+  "CMakeFiles/test_longrange.dir/test_srtable.cpp.o.d"
+  "CMakeFiles/test_longrange.dir/test_temp.cpp.o"
+  "CMakeFiles/test_longrange.dir/test_temp.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_longrange.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
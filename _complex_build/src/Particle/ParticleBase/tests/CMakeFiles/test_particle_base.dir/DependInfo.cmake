@@ -0,0 +1,31 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/Particle/ParticleBase/tests/test_attrib_ops.cpp" "src/Particle/ParticleBase/tests/CMakeFiles/test_particle_base.dir/test_attrib_ops.cpp.o" "gcc" "src/Particle/ParticleBase/tests/CMakeFiles/test_particle_base.dir/test_attrib_ops.cpp.o.d"
+  "/root/repo/src/Particle/ParticleBase/tests/test_particle_attrib.cpp" "src/Particle/ParticleBase/tests/CMakeFiles/test_particle_base.dir/test_particle_attrib.cpp.o" "gcc" "src/Particle/ParticleBase/tests/CMakeFiles/test_particle_base.dir/test_particle_attrib.cpp.o.d"
+  "/root/repo/src/Particle/ParticleBase/tests/test_random_seq.cpp" "src/Particle/ParticleBase/tests/CMakeFiles/test_particle_base.dir/test_random_seq.cpp.o" "gcc" "src/Particle/ParticleBase/tests/CMakeFiles/test_particle_base.dir/test_random_seq.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_complex_build/src/Message/CMakeFiles/catch_main.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Particle/CMakeFiles/qmcparticle.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/CMakeFiles/qmcfakerng.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/CMakeFiles/qmcutil.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Containers/CMakeFiles/containers.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/CMakeFiles/platform_device.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Message/CMakeFiles/message.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/CMakeFiles/platform_host.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/CPU/CMakeFiles/platform_cpu.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/OpenMP/CMakeFiles/platform_omp.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../../../tests/bin/test_particle_base"
+  "../../../../tests/bin/test_particle_base.pdb"
+  "CMakeFiles/test_particle_base.dir/test_attrib_ops.cpp.o"
+  "CMakeFiles/test_particle_base.dir/test_attrib_ops.cpp.o.d"
+  "CMakeFiles/test_particle_base.dir/test_particle_attrib.cpp.o"
+  "CMakeFiles/test_particle_base.dir/test_particle_attrib.cpp.o.d"
+  "CMakeFiles/test_particle_base.dir/test_random_seq.cpp.o"
+  "CMakeFiles/test_particle_base.dir/test_random_seq.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_particle_base.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
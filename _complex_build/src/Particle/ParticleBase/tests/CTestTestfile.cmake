@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/Particle/ParticleBase/tests
+# Build directory: /root/repo/_complex_build/src/Particle/ParticleBase/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(deterministic-unit_test_particle_base "/root/repo/_complex_build/tests/bin/test_particle_base")
+set_tests_properties(deterministic-unit_test_particle_base PROPERTIES  LABELS "quality_unknown;deterministic;unit" _BACKTRACE_TRIPLES "/root/repo/CMake/unit_test.cmake;11;ADD_TEST;/root/repo/src/Particle/ParticleBase/tests/CMakeLists.txt;28;ADD_UNIT_TEST;/root/repo/src/Particle/ParticleBase/tests/CMakeLists.txt;0;")
@@ -0,0 +1,30 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/Particle/ParticleIO/tests/test_lattice_parser.cpp" "src/Particle/ParticleIO/tests/CMakeFiles/test_particleio.dir/test_lattice_parser.cpp.o" "gcc" "src/Particle/ParticleIO/tests/CMakeFiles/test_particleio.dir/test_lattice_parser.cpp.o.d"
+  "/root/repo/src/Particle/ParticleIO/tests/test_xml_io.cpp" "src/Particle/ParticleIO/tests/CMakeFiles/test_particleio.dir/test_xml_io.cpp.o" "gcc" "src/Particle/ParticleIO/tests/CMakeFiles/test_particleio.dir/test_xml_io.cpp.o.d"
+  "/root/repo/src/Particle/ParticleIO/tests/test_xml_mass.cpp" "src/Particle/ParticleIO/tests/CMakeFiles/test_particleio.dir/test_xml_mass.cpp.o" "gcc" "src/Particle/ParticleIO/tests/CMakeFiles/test_particleio.dir/test_xml_mass.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_complex_build/src/Message/CMakeFiles/catch_main.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Particle/CMakeFiles/qmcparticle.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/CMakeFiles/qmcutil.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Containers/CMakeFiles/containers.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/CMakeFiles/platform_device.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Message/CMakeFiles/message.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/CMakeFiles/platform_host.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/CPU/CMakeFiles/platform_cpu.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/OpenMP/CMakeFiles/platform_omp.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
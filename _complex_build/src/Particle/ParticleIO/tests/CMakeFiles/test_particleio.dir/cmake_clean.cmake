@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../../../tests/bin/test_particleio"
+  "../../../../tests/bin/test_particleio.pdb"
+  "CMakeFiles/test_particleio.dir/test_lattice_parser.cpp.o"
+  "CMakeFiles/test_particleio.dir/test_lattice_parser.cpp.o.d"
+  "CMakeFiles/test_particleio.dir/test_xml_io.cpp.o"
+  "CMakeFiles/test_particleio.dir/test_xml_io.cpp.o.d"
+  "CMakeFiles/test_particleio.dir/test_xml_mass.cpp.o"
+  "CMakeFiles/test_particleio.dir/test_xml_mass.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_particleio.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "../../../tests/bin/test_particle"
+  "../../../tests/bin/test_particle.pdb"
+  "CMakeFiles/test_particle.dir/test_distance_table.cpp.o"
+  "CMakeFiles/test_particle.dir/test_distance_table.cpp.o.d"
+  "CMakeFiles/test_particle.dir/test_minimum_image.cpp.o"
+  "CMakeFiles/test_particle.dir/test_minimum_image.cpp.o.d"
+  "CMakeFiles/test_particle.dir/test_particle.cpp.o"
+  "CMakeFiles/test_particle.dir/test_particle.cpp.o.d"
+  "CMakeFiles/test_particle.dir/test_particle_pool.cpp.o"
+  "CMakeFiles/test_particle.dir/test_particle_pool.cpp.o.d"
+  "CMakeFiles/test_particle.dir/test_sample_stack.cpp.o"
+  "CMakeFiles/test_particle.dir/test_sample_stack.cpp.o.d"
+  "CMakeFiles/test_particle.dir/test_walker.cpp.o"
+  "CMakeFiles/test_particle.dir/test_walker.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_particle.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
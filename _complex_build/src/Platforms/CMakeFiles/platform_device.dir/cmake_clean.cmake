@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../lib/libplatform_device.a"
+  "../../lib/libplatform_device.pdb"
+  "CMakeFiles/platform_device.dir/accelerators.cpp.o"
+  "CMakeFiles/platform_device.dir/accelerators.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/platform_device.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
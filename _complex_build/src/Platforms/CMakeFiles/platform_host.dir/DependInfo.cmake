@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/Platforms/Host/InfoStream.cpp" "src/Platforms/CMakeFiles/platform_host.dir/Host/InfoStream.cpp.o" "gcc" "src/Platforms/CMakeFiles/platform_host.dir/Host/InfoStream.cpp.o.d"
+  "/root/repo/src/Platforms/Host/OutputManager.cpp" "src/Platforms/CMakeFiles/platform_host.dir/Host/OutputManager.cpp.o" "gcc" "src/Platforms/CMakeFiles/platform_host.dir/Host/OutputManager.cpp.o.d"
+  "/root/repo/src/Platforms/sysutil.cpp" "src/Platforms/CMakeFiles/platform_host.dir/sysutil.cpp.o" "gcc" "src/Platforms/CMakeFiles/platform_host.dir/sysutil.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../lib/libplatform_host.a"
+  "../../lib/libplatform_host.pdb"
+  "CMakeFiles/platform_host.dir/Host/InfoStream.cpp.o"
+  "CMakeFiles/platform_host.dir/Host/InfoStream.cpp.o.d"
+  "CMakeFiles/platform_host.dir/Host/OutputManager.cpp.o"
+  "CMakeFiles/platform_host.dir/Host/OutputManager.cpp.o.d"
+  "CMakeFiles/platform_host.dir/sysutil.cpp.o"
+  "CMakeFiles/platform_host.dir/sysutil.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/platform_host.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
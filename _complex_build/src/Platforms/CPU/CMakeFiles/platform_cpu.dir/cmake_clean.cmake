@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../lib/libplatform_cpu.a"
+  "../../../lib/libplatform_cpu.pdb"
+  "CMakeFiles/platform_cpu.dir/BlasThreadingEnv.cpp.o"
+  "CMakeFiles/platform_cpu.dir/BlasThreadingEnv.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/platform_cpu.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
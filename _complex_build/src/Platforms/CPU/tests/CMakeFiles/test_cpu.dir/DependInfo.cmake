@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/Platforms/CPU/tests/test_aligned_allocator.cpp" "src/Platforms/CPU/tests/CMakeFiles/test_cpu.dir/test_aligned_allocator.cpp.o" "gcc" "src/Platforms/CPU/tests/CMakeFiles/test_cpu.dir/test_aligned_allocator.cpp.o.d"
+  "/root/repo/src/Platforms/CPU/tests/test_e2iphi.cpp" "src/Platforms/CPU/tests/CMakeFiles/test_cpu.dir/test_e2iphi.cpp.o" "gcc" "src/Platforms/CPU/tests/CMakeFiles/test_cpu.dir/test_e2iphi.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_complex_build/src/Platforms/CPU/CMakeFiles/platform_cpu.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Message/CMakeFiles/catch_main.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Message/CMakeFiles/message.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/CMakeFiles/platform_host.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../../tests/bin/test_cpu"
+  "../../../../tests/bin/test_cpu.pdb"
+  "CMakeFiles/test_cpu.dir/test_aligned_allocator.cpp.o"
+  "CMakeFiles/test_cpu.dir/test_aligned_allocator.cpp.o.d"
+  "CMakeFiles/test_cpu.dir/test_e2iphi.cpp.o"
+  "CMakeFiles/test_cpu.dir/test_e2iphi.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_cpu.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/Platforms/CPU/tests
+# Build directory: /root/repo/_complex_build/src/Platforms/CPU/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(deterministic-unit_test_cpu "/root/repo/_complex_build/tests/bin/test_cpu")
+set_tests_properties(deterministic-unit_test_cpu PROPERTIES  LABELS "quality_unknown;deterministic;unit" _BACKTRACE_TRIPLES "/root/repo/CMake/unit_test.cmake;11;ADD_TEST;/root/repo/src/Platforms/CPU/tests/CMakeLists.txt;22;ADD_UNIT_TEST;/root/repo/src/Platforms/CPU/tests/CMakeLists.txt;0;")
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/Platforms
+# Build directory: /root/repo/_complex_build/src/Platforms
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("CPU")
+subdirs("OpenMP")
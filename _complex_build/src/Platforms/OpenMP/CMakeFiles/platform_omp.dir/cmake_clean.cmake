@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../lib/libplatform_omp.a"
+  "../../../lib/libplatform_omp.pdb"
+  "CMakeFiles/platform_omp.dir/ompBLAS.cpp.o"
+  "CMakeFiles/platform_omp.dir/ompBLAS.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/platform_omp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
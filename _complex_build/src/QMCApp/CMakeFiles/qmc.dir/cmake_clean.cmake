@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "../../lib/libqmc.a"
+  "../../lib/libqmc.pdb"
+  "CMakeFiles/qmc.dir/CoupledMC.cpp.o"
+  "CMakeFiles/qmc.dir/CoupledMC.cpp.o.d"
+  "CMakeFiles/qmc.dir/QMCAppBase.cpp.o"
+  "CMakeFiles/qmc.dir/QMCAppBase.cpp.o.d"
+  "CMakeFiles/qmc.dir/QMCMain.cpp.o"
+  "CMakeFiles/qmc.dir/QMCMain.cpp.o.d"
+  "CMakeFiles/qmc.dir/QMCMainState.cpp.o"
+  "CMakeFiles/qmc.dir/QMCMainState.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/qmc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,33 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/QMCApp/qmcapp.cpp" "src/QMCApp/CMakeFiles/qmcpack.dir/qmcapp.cpp.o" "gcc" "src/QMCApp/CMakeFiles/qmcpack.dir/qmcapp.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_complex_build/src/QMCApp/CMakeFiles/qmc.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/QMCDrivers/CMakeFiles/qmcdriver.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/QMCHamiltonians/CMakeFiles/qmcham.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Particle/CMakeFiles/qmcparticle.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/CMakeFiles/qmcutil.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Containers/CMakeFiles/containers.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/CMakeFiles/platform_device.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Message/CMakeFiles/message.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/CMakeFiles/platform_host.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/CPU/CMakeFiles/platform_cpu.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/OpenMP/CMakeFiles/platform_omp.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/einspline/CMakeFiles/einspline.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/formic/utils/CMakeFiles/formic_utils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/qmcpack"
+  "../../bin/qmcpack.pdb"
+  "CMakeFiles/qmcpack.dir/qmcapp.cpp.o"
+  "CMakeFiles/qmcpack.dir/qmcapp.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/qmcpack.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
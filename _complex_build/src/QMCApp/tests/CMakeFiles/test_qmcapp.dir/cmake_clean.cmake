@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../tests/bin/test_qmcapp"
+  "../../../tests/bin/test_qmcapp.pdb"
+  "CMakeFiles/test_qmcapp.dir/test_project_data.cpp.o"
+  "CMakeFiles/test_qmcapp.dir/test_project_data.cpp.o.d"
+  "CMakeFiles/test_qmcapp.dir/test_rng_control.cpp.o"
+  "CMakeFiles/test_qmcapp.dir/test_rng_control.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_qmcapp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
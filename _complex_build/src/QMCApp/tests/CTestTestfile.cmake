@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/QMCApp/tests
+# Build directory: /root/repo/_complex_build/src/QMCApp/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(deterministic-unit_test_qmcapp "/root/repo/_complex_build/tests/bin/test_qmcapp")
+set_tests_properties(deterministic-unit_test_qmcapp PROPERTIES  LABELS "quality_unknown;deterministic;unit" _BACKTRACE_TRIPLES "/root/repo/CMake/unit_test.cmake;11;ADD_TEST;/root/repo/src/QMCApp/tests/CMakeLists.txt;28;ADD_UNIT_TEST;/root/repo/src/QMCApp/tests/CMakeLists.txt;0;")
@@ -0,0 +1,145 @@
+file(REMOVE_RECURSE
+  "../../lib/libqmcdriver.a"
+  "../../lib/libqmcdriver.pdb"
+  "CMakeFiles/qmcdriver.dir/BranchIO.cpp.o"
+  "CMakeFiles/qmcdriver.dir/BranchIO.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/CloneManager.cpp.o"
+  "CMakeFiles/qmcdriver.dir/CloneManager.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/ContextForSteps.cpp.o"
+  "CMakeFiles/qmcdriver.dir/ContextForSteps.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/CorrelatedSampling/CSUpdateBase.cpp.o"
+  "CMakeFiles/qmcdriver.dir/CorrelatedSampling/CSUpdateBase.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/CorrelatedSampling/CSVMC.cpp.o"
+  "CMakeFiles/qmcdriver.dir/CorrelatedSampling/CSVMC.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/CorrelatedSampling/CSVMCBatched.cpp.o"
+  "CMakeFiles/qmcdriver.dir/CorrelatedSampling/CSVMCBatched.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/CorrelatedSampling/CSVMCFactoryNew.cpp.o"
+  "CMakeFiles/qmcdriver.dir/CorrelatedSampling/CSVMCFactoryNew.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/CorrelatedSampling/CSVMCUpdateAll.cpp.o"
+  "CMakeFiles/qmcdriver.dir/CorrelatedSampling/CSVMCUpdateAll.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/CorrelatedSampling/CSVMCUpdatePbyP.cpp.o"
+  "CMakeFiles/qmcdriver.dir/CorrelatedSampling/CSVMCUpdatePbyP.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/Crowd.cpp.o"
+  "CMakeFiles/qmcdriver.dir/Crowd.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/DMC/DMC.cpp.o"
+  "CMakeFiles/qmcdriver.dir/DMC/DMC.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/DMC/DMCBatched.cpp.o"
+  "CMakeFiles/qmcdriver.dir/DMC/DMCBatched.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/DMC/DMCDriverInput.cpp.o"
+  "CMakeFiles/qmcdriver.dir/DMC/DMCDriverInput.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/DMC/DMCFactory.cpp.o"
+  "CMakeFiles/qmcdriver.dir/DMC/DMCFactory.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/DMC/DMCFactoryNew.cpp.o"
+  "CMakeFiles/qmcdriver.dir/DMC/DMCFactoryNew.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/DMC/DMCUpdateAll.cpp.o"
+  "CMakeFiles/qmcdriver.dir/DMC/DMCUpdateAll.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/DMC/DMCUpdatePbyPFast.cpp.o"
+  "CMakeFiles/qmcdriver.dir/DMC/DMCUpdatePbyPFast.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/DMC/SODMCUpdatePbyPFast.cpp.o"
+  "CMakeFiles/qmcdriver.dir/DMC/SODMCUpdatePbyPFast.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/DMC/WalkerControlFactory.cpp.o"
+  "CMakeFiles/qmcdriver.dir/DMC/WalkerControlFactory.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/DMC/WalkerReconfiguration.cpp.o"
+  "CMakeFiles/qmcdriver.dir/DMC/WalkerReconfiguration.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/GreenFunctionModifiers/DriftModifierBuilder.cpp.o"
+  "CMakeFiles/qmcdriver.dir/GreenFunctionModifiers/DriftModifierBuilder.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/GreenFunctionModifiers/DriftModifierUNR.cpp.o"
+  "CMakeFiles/qmcdriver.dir/GreenFunctionModifiers/DriftModifierUNR.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/LMYEngineInterface/LMYE_QMCCostFunction.cpp.o"
+  "CMakeFiles/qmcdriver.dir/LMYEngineInterface/LMYE_QMCCostFunction.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/LMYEngineInterface/LMYE_QMCCostFunctionBatched.cpp.o"
+  "CMakeFiles/qmcdriver.dir/LMYEngineInterface/LMYE_QMCCostFunctionBatched.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/MCPopulation.cpp.o"
+  "CMakeFiles/qmcdriver.dir/MCPopulation.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/Optimizers/DescentEngine.cpp.o"
+  "CMakeFiles/qmcdriver.dir/Optimizers/DescentEngine.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/Optimizers/HybridEngine.cpp.o"
+  "CMakeFiles/qmcdriver.dir/Optimizers/HybridEngine.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/QMCDriver.cpp.o"
+  "CMakeFiles/qmcdriver.dir/QMCDriver.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/QMCDriverFactory.cpp.o"
+  "CMakeFiles/qmcdriver.dir/QMCDriverFactory.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/QMCDriverInput.cpp.o"
+  "CMakeFiles/qmcdriver.dir/QMCDriverInput.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/QMCDriverNew.cpp.o"
+  "CMakeFiles/qmcdriver.dir/QMCDriverNew.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/QMCUpdateBase.cpp.o"
+  "CMakeFiles/qmcdriver.dir/QMCUpdateBase.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/RMC/RMC.cpp.o"
+  "CMakeFiles/qmcdriver.dir/RMC/RMC.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/RMC/RMCBatched.cpp.o"
+  "CMakeFiles/qmcdriver.dir/RMC/RMCBatched.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/RMC/RMCDriverInput.cpp.o"
+  "CMakeFiles/qmcdriver.dir/RMC/RMCDriverInput.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/RMC/RMCFactory.cpp.o"
+  "CMakeFiles/qmcdriver.dir/RMC/RMCFactory.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/RMC/RMCFactoryNew.cpp.o"
+  "CMakeFiles/qmcdriver.dir/RMC/RMCFactoryNew.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/RMC/RMCUpdateAll.cpp.o"
+  "CMakeFiles/qmcdriver.dir/RMC/RMCUpdateAll.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/RMC/RMCUpdatePbyP.cpp.o"
+  "CMakeFiles/qmcdriver.dir/RMC/RMCUpdatePbyP.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/SimpleFixedNodeBranch.cpp.o"
+  "CMakeFiles/qmcdriver.dir/SimpleFixedNodeBranch.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/VMC/SOVMCUpdatePbyP.cpp.o"
+  "CMakeFiles/qmcdriver.dir/VMC/SOVMCUpdatePbyP.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/VMC/VMC.cpp.o"
+  "CMakeFiles/qmcdriver.dir/VMC/VMC.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/VMC/VMCBatched.cpp.o"
+  "CMakeFiles/qmcdriver.dir/VMC/VMCBatched.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/VMC/VMCDriverInput.cpp.o"
+  "CMakeFiles/qmcdriver.dir/VMC/VMCDriverInput.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/VMC/VMCFactory.cpp.o"
+  "CMakeFiles/qmcdriver.dir/VMC/VMCFactory.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/VMC/VMCFactoryNew.cpp.o"
+  "CMakeFiles/qmcdriver.dir/VMC/VMCFactoryNew.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/VMC/VMCLinearOpt.cpp.o"
+  "CMakeFiles/qmcdriver.dir/VMC/VMCLinearOpt.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/VMC/VMCUpdateAll.cpp.o"
+  "CMakeFiles/qmcdriver.dir/VMC/VMCUpdateAll.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/VMC/VMCUpdatePbyP.cpp.o"
+  "CMakeFiles/qmcdriver.dir/VMC/VMCUpdatePbyP.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/WFOpt/QMCCorrelatedSamplingLinearOptimize.cpp.o"
+  "CMakeFiles/qmcdriver.dir/WFOpt/QMCCorrelatedSamplingLinearOptimize.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/WFOpt/QMCCostFunction.cpp.o"
+  "CMakeFiles/qmcdriver.dir/WFOpt/QMCCostFunction.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/WFOpt/QMCCostFunctionBase.cpp.o"
+  "CMakeFiles/qmcdriver.dir/WFOpt/QMCCostFunctionBase.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/WFOpt/QMCCostFunctionBatched.cpp.o"
+  "CMakeFiles/qmcdriver.dir/WFOpt/QMCCostFunctionBatched.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/WFOpt/QMCFixedSampleLinearOptimize.cpp.o"
+  "CMakeFiles/qmcdriver.dir/WFOpt/QMCFixedSampleLinearOptimize.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/WFOpt/QMCFixedSampleLinearOptimizeBatched.cpp.o"
+  "CMakeFiles/qmcdriver.dir/WFOpt/QMCFixedSampleLinearOptimizeBatched.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/WFOpt/QMCLinearOptimize.cpp.o"
+  "CMakeFiles/qmcdriver.dir/WFOpt/QMCLinearOptimize.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/WFOpt/QMCLinearOptimizeBatched.cpp.o"
+  "CMakeFiles/qmcdriver.dir/WFOpt/QMCLinearOptimizeBatched.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/WFOpt/QMCOptimize.cpp.o"
+  "CMakeFiles/qmcdriver.dir/WFOpt/QMCOptimize.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/WFOpt/QMCOptimizeBatched.cpp.o"
+  "CMakeFiles/qmcdriver.dir/WFOpt/QMCOptimizeBatched.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/WFOpt/QMCWFOptFactoryNew.cpp.o"
+  "CMakeFiles/qmcdriver.dir/WFOpt/QMCWFOptFactoryNew.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/WalkerControlBase.cpp.o"
+  "CMakeFiles/qmcdriver.dir/WalkerControlBase.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/WaveFunctionTester.cpp.o"
+  "CMakeFiles/qmcdriver.dir/WaveFunctionTester.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/__/Estimators/CSEnergyEstimator.cpp.o"
+  "CMakeFiles/qmcdriver.dir/__/Estimators/CSEnergyEstimator.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/__/Estimators/CollectablesEstimator.cpp.o"
+  "CMakeFiles/qmcdriver.dir/__/Estimators/CollectablesEstimator.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/__/Estimators/EstimatorManagerBase.cpp.o"
+  "CMakeFiles/qmcdriver.dir/__/Estimators/EstimatorManagerBase.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/__/Estimators/EstimatorManagerCrowd.cpp.o"
+  "CMakeFiles/qmcdriver.dir/__/Estimators/EstimatorManagerCrowd.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/__/Estimators/LocalEnergyEstimator.cpp.o"
+  "CMakeFiles/qmcdriver.dir/__/Estimators/LocalEnergyEstimator.cpp.o.d"
+  "CMakeFiles/qmcdriver.dir/__/Estimators/RMCLocalEnergyEstimator.cpp.o"
+  "CMakeFiles/qmcdriver.dir/__/Estimators/RMCLocalEnergyEstimator.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/qmcdriver.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
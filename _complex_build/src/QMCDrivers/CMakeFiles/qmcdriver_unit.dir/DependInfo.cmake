@@ -0,0 +1,99 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/QMCDrivers/BranchIO.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/BranchIO.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/BranchIO.cpp.o.d"
+  "/root/repo/src/QMCDrivers/CloneManager.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/CloneManager.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/CloneManager.cpp.o.d"
+  "/root/repo/src/QMCDrivers/ContextForSteps.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/ContextForSteps.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/ContextForSteps.cpp.o.d"
+  "/root/repo/src/QMCDrivers/CorrelatedSampling/CSUpdateBase.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/CorrelatedSampling/CSUpdateBase.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/CorrelatedSampling/CSUpdateBase.cpp.o.d"
+  "/root/repo/src/QMCDrivers/CorrelatedSampling/CSVMC.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/CorrelatedSampling/CSVMC.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/CorrelatedSampling/CSVMC.cpp.o.d"
+  "/root/repo/src/QMCDrivers/CorrelatedSampling/CSVMCBatched.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/CorrelatedSampling/CSVMCBatched.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/CorrelatedSampling/CSVMCBatched.cpp.o.d"
+  "/root/repo/src/QMCDrivers/CorrelatedSampling/CSVMCFactoryNew.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/CorrelatedSampling/CSVMCFactoryNew.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/CorrelatedSampling/CSVMCFactoryNew.cpp.o.d"
+  "/root/repo/src/QMCDrivers/CorrelatedSampling/CSVMCUpdateAll.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/CorrelatedSampling/CSVMCUpdateAll.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/CorrelatedSampling/CSVMCUpdateAll.cpp.o.d"
+  "/root/repo/src/QMCDrivers/CorrelatedSampling/CSVMCUpdatePbyP.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/CorrelatedSampling/CSVMCUpdatePbyP.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/CorrelatedSampling/CSVMCUpdatePbyP.cpp.o.d"
+  "/root/repo/src/QMCDrivers/Crowd.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/Crowd.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/Crowd.cpp.o.d"
+  "/root/repo/src/QMCDrivers/DMC/DMC.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/DMC/DMC.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/DMC/DMC.cpp.o.d"
+  "/root/repo/src/QMCDrivers/DMC/DMCBatched.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/DMC/DMCBatched.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/DMC/DMCBatched.cpp.o.d"
+  "/root/repo/src/QMCDrivers/DMC/DMCDriverInput.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/DMC/DMCDriverInput.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/DMC/DMCDriverInput.cpp.o.d"
+  "/root/repo/src/QMCDrivers/DMC/DMCFactory.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/DMC/DMCFactory.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/DMC/DMCFactory.cpp.o.d"
+  "/root/repo/src/QMCDrivers/DMC/DMCFactoryNew.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/DMC/DMCFactoryNew.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/DMC/DMCFactoryNew.cpp.o.d"
+  "/root/repo/src/QMCDrivers/DMC/DMCUpdateAll.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/DMC/DMCUpdateAll.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/DMC/DMCUpdateAll.cpp.o.d"
+  "/root/repo/src/QMCDrivers/DMC/DMCUpdatePbyPFast.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/DMC/DMCUpdatePbyPFast.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/DMC/DMCUpdatePbyPFast.cpp.o.d"
+  "/root/repo/src/QMCDrivers/DMC/SODMCUpdatePbyPFast.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/DMC/SODMCUpdatePbyPFast.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/DMC/SODMCUpdatePbyPFast.cpp.o.d"
+  "/root/repo/src/QMCDrivers/DMC/WalkerControlFactory.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/DMC/WalkerControlFactory.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/DMC/WalkerControlFactory.cpp.o.d"
+  "/root/repo/src/QMCDrivers/DMC/WalkerReconfiguration.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/DMC/WalkerReconfiguration.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/DMC/WalkerReconfiguration.cpp.o.d"
+  "/root/repo/src/QMCDrivers/GreenFunctionModifiers/DriftModifierBuilder.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/GreenFunctionModifiers/DriftModifierBuilder.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/GreenFunctionModifiers/DriftModifierBuilder.cpp.o.d"
+  "/root/repo/src/QMCDrivers/GreenFunctionModifiers/DriftModifierUNR.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/GreenFunctionModifiers/DriftModifierUNR.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/GreenFunctionModifiers/DriftModifierUNR.cpp.o.d"
+  "/root/repo/src/QMCDrivers/LMYEngineInterface/LMYE_QMCCostFunction.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/LMYEngineInterface/LMYE_QMCCostFunction.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/LMYEngineInterface/LMYE_QMCCostFunction.cpp.o.d"
+  "/root/repo/src/QMCDrivers/LMYEngineInterface/LMYE_QMCCostFunctionBatched.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/LMYEngineInterface/LMYE_QMCCostFunctionBatched.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/LMYEngineInterface/LMYE_QMCCostFunctionBatched.cpp.o.d"
+  "/root/repo/src/QMCDrivers/MCPopulation.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/MCPopulation.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/MCPopulation.cpp.o.d"
+  "/root/repo/src/QMCDrivers/Optimizers/DescentEngine.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/Optimizers/DescentEngine.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/Optimizers/DescentEngine.cpp.o.d"
+  "/root/repo/src/QMCDrivers/Optimizers/HybridEngine.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/Optimizers/HybridEngine.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/Optimizers/HybridEngine.cpp.o.d"
+  "/root/repo/src/QMCDrivers/QMCDriver.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/QMCDriver.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/QMCDriver.cpp.o.d"
+  "/root/repo/src/QMCDrivers/QMCDriverFactory.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/QMCDriverFactory.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/QMCDriverFactory.cpp.o.d"
+  "/root/repo/src/QMCDrivers/QMCDriverInput.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/QMCDriverInput.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/QMCDriverInput.cpp.o.d"
+  "/root/repo/src/QMCDrivers/QMCDriverNew.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/QMCDriverNew.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/QMCDriverNew.cpp.o.d"
+  "/root/repo/src/QMCDrivers/QMCUpdateBase.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/QMCUpdateBase.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/QMCUpdateBase.cpp.o.d"
+  "/root/repo/src/QMCDrivers/RMC/RMC.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/RMC/RMC.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/RMC/RMC.cpp.o.d"
+  "/root/repo/src/QMCDrivers/RMC/RMCBatched.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/RMC/RMCBatched.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/RMC/RMCBatched.cpp.o.d"
+  "/root/repo/src/QMCDrivers/RMC/RMCDriverInput.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/RMC/RMCDriverInput.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/RMC/RMCDriverInput.cpp.o.d"
+  "/root/repo/src/QMCDrivers/RMC/RMCFactory.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/RMC/RMCFactory.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/RMC/RMCFactory.cpp.o.d"
+  "/root/repo/src/QMCDrivers/RMC/RMCFactoryNew.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/RMC/RMCFactoryNew.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/RMC/RMCFactoryNew.cpp.o.d"
+  "/root/repo/src/QMCDrivers/RMC/RMCUpdateAll.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/RMC/RMCUpdateAll.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/RMC/RMCUpdateAll.cpp.o.d"
+  "/root/repo/src/QMCDrivers/RMC/RMCUpdatePbyP.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/RMC/RMCUpdatePbyP.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/RMC/RMCUpdatePbyP.cpp.o.d"
+  "/root/repo/src/QMCDrivers/SimpleFixedNodeBranch.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/SimpleFixedNodeBranch.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/SimpleFixedNodeBranch.cpp.o.d"
+  "/root/repo/src/QMCDrivers/VMC/SOVMCUpdatePbyP.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/VMC/SOVMCUpdatePbyP.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/VMC/SOVMCUpdatePbyP.cpp.o.d"
+  "/root/repo/src/QMCDrivers/VMC/VMC.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/VMC/VMC.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/VMC/VMC.cpp.o.d"
+  "/root/repo/src/QMCDrivers/VMC/VMCBatched.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/VMC/VMCBatched.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/VMC/VMCBatched.cpp.o.d"
+  "/root/repo/src/QMCDrivers/VMC/VMCDriverInput.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/VMC/VMCDriverInput.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/VMC/VMCDriverInput.cpp.o.d"
+  "/root/repo/src/QMCDrivers/VMC/VMCFactory.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/VMC/VMCFactory.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/VMC/VMCFactory.cpp.o.d"
+  "/root/repo/src/QMCDrivers/VMC/VMCFactoryNew.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/VMC/VMCFactoryNew.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/VMC/VMCFactoryNew.cpp.o.d"
+  "/root/repo/src/QMCDrivers/VMC/VMCLinearOpt.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/VMC/VMCLinearOpt.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/VMC/VMCLinearOpt.cpp.o.d"
+  "/root/repo/src/QMCDrivers/VMC/VMCUpdateAll.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/VMC/VMCUpdateAll.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/VMC/VMCUpdateAll.cpp.o.d"
+  "/root/repo/src/QMCDrivers/VMC/VMCUpdatePbyP.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/VMC/VMCUpdatePbyP.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/VMC/VMCUpdatePbyP.cpp.o.d"
+  "/root/repo/src/QMCDrivers/WFOpt/QMCCorrelatedSamplingLinearOptimize.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/WFOpt/QMCCorrelatedSamplingLinearOptimize.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/WFOpt/QMCCorrelatedSamplingLinearOptimize.cpp.o.d"
+  "/root/repo/src/QMCDrivers/WFOpt/QMCCostFunction.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/WFOpt/QMCCostFunction.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/WFOpt/QMCCostFunction.cpp.o.d"
+  "/root/repo/src/QMCDrivers/WFOpt/QMCCostFunctionBase.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/WFOpt/QMCCostFunctionBase.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/WFOpt/QMCCostFunctionBase.cpp.o.d"
+  "/root/repo/src/QMCDrivers/WFOpt/QMCCostFunctionBatched.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/WFOpt/QMCCostFunctionBatched.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/WFOpt/QMCCostFunctionBatched.cpp.o.d"
+  "/root/repo/src/QMCDrivers/WFOpt/QMCFixedSampleLinearOptimize.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/WFOpt/QMCFixedSampleLinearOptimize.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/WFOpt/QMCFixedSampleLinearOptimize.cpp.o.d"
+  "/root/repo/src/QMCDrivers/WFOpt/QMCFixedSampleLinearOptimizeBatched.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/WFOpt/QMCFixedSampleLinearOptimizeBatched.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/WFOpt/QMCFixedSampleLinearOptimizeBatched.cpp.o.d"
+  "/root/repo/src/QMCDrivers/WFOpt/QMCLinearOptimize.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/WFOpt/QMCLinearOptimize.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/WFOpt/QMCLinearOptimize.cpp.o.d"
+  "/root/repo/src/QMCDrivers/WFOpt/QMCLinearOptimizeBatched.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/WFOpt/QMCLinearOptimizeBatched.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/WFOpt/QMCLinearOptimizeBatched.cpp.o.d"
+  "/root/repo/src/QMCDrivers/WFOpt/QMCOptimize.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/WFOpt/QMCOptimize.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/WFOpt/QMCOptimize.cpp.o.d"
+  "/root/repo/src/QMCDrivers/WFOpt/QMCOptimizeBatched.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/WFOpt/QMCOptimizeBatched.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/WFOpt/QMCOptimizeBatched.cpp.o.d"
+  "/root/repo/src/QMCDrivers/WFOpt/QMCWFOptFactoryNew.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/WFOpt/QMCWFOptFactoryNew.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/WFOpt/QMCWFOptFactoryNew.cpp.o.d"
+  "/root/repo/src/QMCDrivers/WalkerControlBase.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/WalkerControlBase.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/WalkerControlBase.cpp.o.d"
+  "/root/repo/src/QMCDrivers/WaveFunctionTester.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/WaveFunctionTester.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/WaveFunctionTester.cpp.o.d"
+  "/root/repo/src/Estimators/CSEnergyEstimator.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/__/Estimators/CSEnergyEstimator.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/__/Estimators/CSEnergyEstimator.cpp.o.d"
+  "/root/repo/src/Estimators/CollectablesEstimator.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/__/Estimators/CollectablesEstimator.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/__/Estimators/CollectablesEstimator.cpp.o.d"
+  "/root/repo/src/Estimators/EstimatorManagerBase.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/__/Estimators/EstimatorManagerBase.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/__/Estimators/EstimatorManagerBase.cpp.o.d"
+  "/root/repo/src/Estimators/EstimatorManagerCrowd.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/__/Estimators/EstimatorManagerCrowd.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/__/Estimators/EstimatorManagerCrowd.cpp.o.d"
+  "/root/repo/src/Estimators/LocalEnergyEstimator.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/__/Estimators/LocalEnergyEstimator.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/__/Estimators/LocalEnergyEstimator.cpp.o.d"
+  "/root/repo/src/Estimators/RMCLocalEnergyEstimator.cpp" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/__/Estimators/RMCLocalEnergyEstimator.cpp.o" "gcc" "src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/__/Estimators/RMCLocalEnergyEstimator.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_complex_build/src/QMCHamiltonians/CMakeFiles/qmcham_unit.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/formic/utils/CMakeFiles/formic_utils.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/CMakeFiles/qmcfakerng.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Particle/CMakeFiles/qmcparticle.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/CMakeFiles/qmcutil.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Containers/CMakeFiles/containers.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/CMakeFiles/platform_device.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Message/CMakeFiles/message.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/CMakeFiles/platform_host.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/CPU/CMakeFiles/platform_cpu.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/OpenMP/CMakeFiles/platform_omp.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/einspline/CMakeFiles/einspline.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
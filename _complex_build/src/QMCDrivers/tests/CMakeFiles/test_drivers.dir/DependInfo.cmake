@@ -0,0 +1,43 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/QMCDrivers/tests/test_DescentEngine.cpp" "src/QMCDrivers/tests/CMakeFiles/test_drivers.dir/test_DescentEngine.cpp.o" "gcc" "src/QMCDrivers/tests/CMakeFiles/test_drivers.dir/test_DescentEngine.cpp.o.d"
+  "/root/repo/src/QMCDrivers/tests/test_HybridEngine.cpp" "src/QMCDrivers/tests/CMakeFiles/test_drivers.dir/test_HybridEngine.cpp.o" "gcc" "src/QMCDrivers/tests/CMakeFiles/test_drivers.dir/test_HybridEngine.cpp.o.d"
+  "/root/repo/src/QMCDrivers/tests/test_QMCDriverFactory.cpp" "src/QMCDrivers/tests/CMakeFiles/test_drivers.dir/test_QMCDriverFactory.cpp.o" "gcc" "src/QMCDrivers/tests/CMakeFiles/test_drivers.dir/test_QMCDriverFactory.cpp.o.d"
+  "/root/repo/src/QMCDrivers/tests/test_clone_manager.cpp" "src/QMCDrivers/tests/CMakeFiles/test_drivers.dir/test_clone_manager.cpp.o" "gcc" "src/QMCDrivers/tests/CMakeFiles/test_drivers.dir/test_clone_manager.cpp.o.d"
+  "/root/repo/src/QMCDrivers/tests/test_dmc.cpp" "src/QMCDrivers/tests/CMakeFiles/test_drivers.dir/test_dmc.cpp.o" "gcc" "src/QMCDrivers/tests/CMakeFiles/test_drivers.dir/test_dmc.cpp.o.d"
+  "/root/repo/src/QMCDrivers/tests/test_dmc_driver.cpp" "src/QMCDrivers/tests/CMakeFiles/test_drivers.dir/test_dmc_driver.cpp.o" "gcc" "src/QMCDrivers/tests/CMakeFiles/test_drivers.dir/test_dmc_driver.cpp.o.d"
+  "/root/repo/src/QMCDrivers/tests/test_drift.cpp" "src/QMCDrivers/tests/CMakeFiles/test_drivers.dir/test_drift.cpp.o" "gcc" "src/QMCDrivers/tests/CMakeFiles/test_drivers.dir/test_drift.cpp.o.d"
+  "/root/repo/src/QMCDrivers/tests/test_fixed_node_branch.cpp" "src/QMCDrivers/tests/CMakeFiles/test_drivers.dir/test_fixed_node_branch.cpp.o" "gcc" "src/QMCDrivers/tests/CMakeFiles/test_drivers.dir/test_fixed_node_branch.cpp.o.d"
+  "/root/repo/src/QMCDrivers/tests/test_vmc.cpp" "src/QMCDrivers/tests/CMakeFiles/test_drivers.dir/test_vmc.cpp.o" "gcc" "src/QMCDrivers/tests/CMakeFiles/test_drivers.dir/test_vmc.cpp.o.d"
+  "/root/repo/src/QMCDrivers/tests/test_vmc_driver.cpp" "src/QMCDrivers/tests/CMakeFiles/test_drivers.dir/test_vmc_driver.cpp.o" "gcc" "src/QMCDrivers/tests/CMakeFiles/test_drivers.dir/test_vmc_driver.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_complex_build/src/Message/CMakeFiles/catch_main.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/CMakeFiles/qmcfakerng.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/QMCHamiltonians/CMakeFiles/qmcham_unit.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Particle/CMakeFiles/qmcparticle.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/CMakeFiles/qmcutil.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Containers/CMakeFiles/containers.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/CMakeFiles/platform_device.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Message/CMakeFiles/message.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/CMakeFiles/platform_host.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/CPU/CMakeFiles/platform_cpu.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/OpenMP/CMakeFiles/platform_omp.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/einspline/CMakeFiles/einspline.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/formic/utils/CMakeFiles/formic_utils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,29 @@
+file(REMOVE_RECURSE
+  "../../../tests/bin/test_drivers"
+  "../../../tests/bin/test_drivers.pdb"
+  "CMakeFiles/test_drivers.dir/test_DescentEngine.cpp.o"
+  "CMakeFiles/test_drivers.dir/test_DescentEngine.cpp.o.d"
+  "CMakeFiles/test_drivers.dir/test_HybridEngine.cpp.o"
+  "CMakeFiles/test_drivers.dir/test_HybridEngine.cpp.o.d"
+  "CMakeFiles/test_drivers.dir/test_QMCDriverFactory.cpp.o"
+  "CMakeFiles/test_drivers.dir/test_QMCDriverFactory.cpp.o.d"
+  "CMakeFiles/test_drivers.dir/test_clone_manager.cpp.o"
+  "CMakeFiles/test_drivers.dir/test_clone_manager.cpp.o.d"
+  "CMakeFiles/test_drivers.dir/test_dmc.cpp.o"
+  "CMakeFiles/test_drivers.dir/test_dmc.cpp.o.d"
+  "CMakeFiles/test_drivers.dir/test_dmc_driver.cpp.o"
+  "CMakeFiles/test_drivers.dir/test_dmc_driver.cpp.o.d"
+  "CMakeFiles/test_drivers.dir/test_drift.cpp.o"
+  "CMakeFiles/test_drivers.dir/test_drift.cpp.o.d"
+  "CMakeFiles/test_drivers.dir/test_fixed_node_branch.cpp.o"
+  "CMakeFiles/test_drivers.dir/test_fixed_node_branch.cpp.o.d"
+  "CMakeFiles/test_drivers.dir/test_vmc.cpp.o"
+  "CMakeFiles/test_drivers.dir/test_vmc.cpp.o.d"
+  "CMakeFiles/test_drivers.dir/test_vmc_driver.cpp.o"
+  "CMakeFiles/test_drivers.dir/test_vmc_driver.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_drivers.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
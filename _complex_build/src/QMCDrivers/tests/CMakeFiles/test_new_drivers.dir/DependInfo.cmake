@@ -0,0 +1,46 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/QMCDrivers/tests/SetupPools.cpp" "src/QMCDrivers/tests/CMakeFiles/test_new_drivers.dir/SetupPools.cpp.o" "gcc" "src/QMCDrivers/tests/CMakeFiles/test_new_drivers.dir/SetupPools.cpp.o.d"
+  "/root/repo/src/QMCDrivers/tests/test_CSVMCBatched.cpp" "src/QMCDrivers/tests/CMakeFiles/test_new_drivers.dir/test_CSVMCBatched.cpp.o" "gcc" "src/QMCDrivers/tests/CMakeFiles/test_new_drivers.dir/test_CSVMCBatched.cpp.o.d"
+  "/root/repo/src/QMCDrivers/tests/test_ContextForSteps.cpp" "src/QMCDrivers/tests/CMakeFiles/test_new_drivers.dir/test_ContextForSteps.cpp.o" "gcc" "src/QMCDrivers/tests/CMakeFiles/test_new_drivers.dir/test_ContextForSteps.cpp.o.d"
+  "/root/repo/src/QMCDrivers/tests/test_Crowd.cpp" "src/QMCDrivers/tests/CMakeFiles/test_new_drivers.dir/test_Crowd.cpp.o" "gcc" "src/QMCDrivers/tests/CMakeFiles/test_new_drivers.dir/test_Crowd.cpp.o.d"
+  "/root/repo/src/QMCDrivers/tests/test_DMCBatched.cpp" "src/QMCDrivers/tests/CMakeFiles/test_new_drivers.dir/test_DMCBatched.cpp.o" "gcc" "src/QMCDrivers/tests/CMakeFiles/test_new_drivers.dir/test_DMCBatched.cpp.o.d"
+  "/root/repo/src/QMCDrivers/tests/test_MCPopulation.cpp" "src/QMCDrivers/tests/CMakeFiles/test_new_drivers.dir/test_MCPopulation.cpp.o" "gcc" "src/QMCDrivers/tests/CMakeFiles/test_new_drivers.dir/test_MCPopulation.cpp.o.d"
+  "/root/repo/src/QMCDrivers/tests/test_QMCDriverInput.cpp" "src/QMCDrivers/tests/CMakeFiles/test_new_drivers.dir/test_QMCDriverInput.cpp.o" "gcc" "src/QMCDrivers/tests/CMakeFiles/test_new_drivers.dir/test_QMCDriverInput.cpp.o.d"
+  "/root/repo/src/QMCDrivers/tests/test_QMCDriverNew.cpp" "src/QMCDrivers/tests/CMakeFiles/test_new_drivers.dir/test_QMCDriverNew.cpp.o" "gcc" "src/QMCDrivers/tests/CMakeFiles/test_new_drivers.dir/test_QMCDriverNew.cpp.o.d"
+  "/root/repo/src/QMCDrivers/tests/test_ReptileRing.cpp" "src/QMCDrivers/tests/CMakeFiles/test_new_drivers.dir/test_ReptileRing.cpp.o" "gcc" "src/QMCDrivers/tests/CMakeFiles/test_new_drivers.dir/test_ReptileRing.cpp.o.d"
+  "/root/repo/src/QMCDrivers/tests/test_SimpleFixedNodeBranch.cpp" "src/QMCDrivers/tests/CMakeFiles/test_new_drivers.dir/test_SimpleFixedNodeBranch.cpp.o" "gcc" "src/QMCDrivers/tests/CMakeFiles/test_new_drivers.dir/test_SimpleFixedNodeBranch.cpp.o.d"
+  "/root/repo/src/QMCDrivers/tests/test_VMCBatched.cpp" "src/QMCDrivers/tests/CMakeFiles/test_new_drivers.dir/test_VMCBatched.cpp.o" "gcc" "src/QMCDrivers/tests/CMakeFiles/test_new_drivers.dir/test_VMCBatched.cpp.o.d"
+  "/root/repo/src/QMCDrivers/tests/test_VMCDriverInput.cpp" "src/QMCDrivers/tests/CMakeFiles/test_new_drivers.dir/test_VMCDriverInput.cpp.o" "gcc" "src/QMCDrivers/tests/CMakeFiles/test_new_drivers.dir/test_VMCDriverInput.cpp.o.d"
+  "/root/repo/src/QMCDrivers/tests/test_VMCFactoryNew.cpp" "src/QMCDrivers/tests/CMakeFiles/test_new_drivers.dir/test_VMCFactoryNew.cpp.o" "gcc" "src/QMCDrivers/tests/CMakeFiles/test_new_drivers.dir/test_VMCFactoryNew.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_complex_build/src/Message/CMakeFiles/catch_main.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/QMCDrivers/CMakeFiles/qmcdriver_unit.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/CMakeFiles/qmcfakerng.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/QMCHamiltonians/CMakeFiles/qmcham_unit.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Particle/CMakeFiles/qmcparticle.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/CMakeFiles/qmcutil.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Containers/CMakeFiles/containers.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/CMakeFiles/platform_device.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Message/CMakeFiles/message.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/CMakeFiles/platform_host.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/CPU/CMakeFiles/platform_cpu.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/OpenMP/CMakeFiles/platform_omp.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/einspline/CMakeFiles/einspline.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/formic/utils/CMakeFiles/formic_utils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
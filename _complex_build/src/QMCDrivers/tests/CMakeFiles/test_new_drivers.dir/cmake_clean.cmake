@@ -0,0 +1,35 @@
+file(REMOVE_RECURSE
+  "../../../tests/bin/test_new_drivers"
+  "../../../tests/bin/test_new_drivers.pdb"
+  "CMakeFiles/test_new_drivers.dir/SetupPools.cpp.o"
+  "CMakeFiles/test_new_drivers.dir/SetupPools.cpp.o.d"
+  "CMakeFiles/test_new_drivers.dir/test_CSVMCBatched.cpp.o"
+  "CMakeFiles/test_new_drivers.dir/test_CSVMCBatched.cpp.o.d"
+  "CMakeFiles/test_new_drivers.dir/test_ContextForSteps.cpp.o"
+  "CMakeFiles/test_new_drivers.dir/test_ContextForSteps.cpp.o.d"
+  "CMakeFiles/test_new_drivers.dir/test_Crowd.cpp.o"
+  "CMakeFiles/test_new_drivers.dir/test_Crowd.cpp.o.d"
+  "CMakeFiles/test_new_drivers.dir/test_DMCBatched.cpp.o"
+  "CMakeFiles/test_new_drivers.dir/test_DMCBatched.cpp.o.d"
+  "CMakeFiles/test_new_drivers.dir/test_MCPopulation.cpp.o"
+  "CMakeFiles/test_new_drivers.dir/test_MCPopulation.cpp.o.d"
+  "CMakeFiles/test_new_drivers.dir/test_QMCDriverInput.cpp.o"
+  "CMakeFiles/test_new_drivers.dir/test_QMCDriverInput.cpp.o.d"
+  "CMakeFiles/test_new_drivers.dir/test_QMCDriverNew.cpp.o"
+  "CMakeFiles/test_new_drivers.dir/test_QMCDriverNew.cpp.o.d"
+  "CMakeFiles/test_new_drivers.dir/test_ReptileRing.cpp.o"
+  "CMakeFiles/test_new_drivers.dir/test_ReptileRing.cpp.o.d"
+  "CMakeFiles/test_new_drivers.dir/test_SimpleFixedNodeBranch.cpp.o"
+  "CMakeFiles/test_new_drivers.dir/test_SimpleFixedNodeBranch.cpp.o.d"
+  "CMakeFiles/test_new_drivers.dir/test_VMCBatched.cpp.o"
+  "CMakeFiles/test_new_drivers.dir/test_VMCBatched.cpp.o.d"
+  "CMakeFiles/test_new_drivers.dir/test_VMCDriverInput.cpp.o"
+  "CMakeFiles/test_new_drivers.dir/test_VMCDriverInput.cpp.o.d"
+  "CMakeFiles/test_new_drivers.dir/test_VMCFactoryNew.cpp.o"
+  "CMakeFiles/test_new_drivers.dir/test_VMCFactoryNew.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_new_drivers.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
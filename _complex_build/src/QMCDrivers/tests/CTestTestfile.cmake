@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/QMCDrivers/tests
+# Build directory: /root/repo/_complex_build/src/QMCDrivers/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(deterministic-unit_test_drivers "/root/repo/_complex_build/tests/bin/test_drivers")
+set_tests_properties(deterministic-unit_test_drivers PROPERTIES  LABELS "quality_unknown;deterministic;unit" WORKING_DIRECTORY "/root/repo/_complex_build/tests/drivers" _BACKTRACE_TRIPLES "/root/repo/CMake/unit_test.cmake;11;ADD_TEST;/root/repo/src/QMCDrivers/tests/CMakeLists.txt;51;ADD_UNIT_TEST;/root/repo/src/QMCDrivers/tests/CMakeLists.txt;0;")
+add_test(deterministic-unit_test_new_drivers "/root/repo/_complex_build/tests/bin/test_new_drivers")
+set_tests_properties(deterministic-unit_test_new_drivers PROPERTIES  LABELS "quality_unknown;deterministic;unit" WORKING_DIRECTORY "/root/repo/_complex_build/tests/drivers" _BACKTRACE_TRIPLES "/root/repo/CMake/unit_test.cmake;11;ADD_TEST;/root/repo/src/QMCDrivers/tests/CMakeLists.txt;74;ADD_UNIT_TEST;/root/repo/src/QMCDrivers/tests/CMakeLists.txt;0;")
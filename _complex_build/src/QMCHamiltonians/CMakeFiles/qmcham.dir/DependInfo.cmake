@@ -0,0 +1,73 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/QMCHamiltonians/ACForce.cpp" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/ACForce.cpp.o" "gcc" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/ACForce.cpp.o.d"
+  "/root/repo/src/QMCHamiltonians/ChiesaCorrection.cpp" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/ChiesaCorrection.cpp.o" "gcc" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/ChiesaCorrection.cpp.o.d"
+  "/root/repo/src/QMCHamiltonians/CoulombPBCAA.cpp" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/CoulombPBCAA.cpp.o" "gcc" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/CoulombPBCAA.cpp.o.d"
+  "/root/repo/src/QMCHamiltonians/CoulombPBCAB.cpp" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/CoulombPBCAB.cpp.o" "gcc" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/CoulombPBCAB.cpp.o.d"
+  "/root/repo/src/QMCHamiltonians/CoulombPotentialFactory.cpp" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/CoulombPotentialFactory.cpp.o" "gcc" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/CoulombPotentialFactory.cpp.o.d"
+  "/root/repo/src/QMCHamiltonians/DensityEstimator.cpp" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/DensityEstimator.cpp.o" "gcc" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/DensityEstimator.cpp.o.d"
+  "/root/repo/src/QMCHamiltonians/DensityMatrices1B.cpp" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/DensityMatrices1B.cpp.o" "gcc" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/DensityMatrices1B.cpp.o.d"
+  "/root/repo/src/QMCHamiltonians/ECPComponentBuilder.1.cpp" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/ECPComponentBuilder.1.cpp.o" "gcc" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/ECPComponentBuilder.1.cpp.o.d"
+  "/root/repo/src/QMCHamiltonians/ECPComponentBuilder.2.cpp" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/ECPComponentBuilder.2.cpp.o" "gcc" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/ECPComponentBuilder.2.cpp.o.d"
+  "/root/repo/src/QMCHamiltonians/ECPComponentBuilder.cpp" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/ECPComponentBuilder.cpp.o" "gcc" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/ECPComponentBuilder.cpp.o.d"
+  "/root/repo/src/QMCHamiltonians/ECPComponentBuilder_L2.cpp" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/ECPComponentBuilder_L2.cpp.o" "gcc" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/ECPComponentBuilder_L2.cpp.o.d"
+  "/root/repo/src/QMCHamiltonians/ECPotentialBuilder.cpp" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/ECPotentialBuilder.cpp.o" "gcc" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/ECPotentialBuilder.cpp.o.d"
+  "/root/repo/src/QMCHamiltonians/EnergyDensityEstimator.cpp" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/EnergyDensityEstimator.cpp.o" "gcc" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/EnergyDensityEstimator.cpp.o.d"
+  "/root/repo/src/QMCHamiltonians/ForceBase.cpp" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/ForceBase.cpp.o" "gcc" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/ForceBase.cpp.o.d"
+  "/root/repo/src/QMCHamiltonians/ForceCeperley.cpp" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/ForceCeperley.cpp.o" "gcc" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/ForceCeperley.cpp.o.d"
+  "/root/repo/src/QMCHamiltonians/ForceChiesaPBCAA.cpp" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/ForceChiesaPBCAA.cpp.o" "gcc" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/ForceChiesaPBCAA.cpp.o.d"
+  "/root/repo/src/QMCHamiltonians/ForwardWalking.cpp" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/ForwardWalking.cpp.o" "gcc" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/ForwardWalking.cpp.o.d"
+  "/root/repo/src/QMCHamiltonians/GridExternalPotential.cpp" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/GridExternalPotential.cpp.o" "gcc" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/GridExternalPotential.cpp.o.d"
+  "/root/repo/src/QMCHamiltonians/HamiltonianFactory.cpp" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/HamiltonianFactory.cpp.o" "gcc" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/HamiltonianFactory.cpp.o.d"
+  "/root/repo/src/QMCHamiltonians/HamiltonianPool.cpp" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/HamiltonianPool.cpp.o" "gcc" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/HamiltonianPool.cpp.o.d"
+  "/root/repo/src/QMCHamiltonians/HarmonicExternalPotential.cpp" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/HarmonicExternalPotential.cpp.o" "gcc" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/HarmonicExternalPotential.cpp.o.d"
+  "/root/repo/src/QMCHamiltonians/L2Potential.cpp" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/L2Potential.cpp.o" "gcc" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/L2Potential.cpp.o.d"
+  "/root/repo/src/QMCHamiltonians/LatticeDeviationEstimator.cpp" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/LatticeDeviationEstimator.cpp.o" "gcc" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/LatticeDeviationEstimator.cpp.o.d"
+  "/root/repo/src/QMCHamiltonians/LocalECPotential.cpp" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/LocalECPotential.cpp.o" "gcc" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/LocalECPotential.cpp.o.d"
+  "/root/repo/src/QMCHamiltonians/MPC.cpp" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/MPC.cpp.o" "gcc" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/MPC.cpp.o.d"
+  "/root/repo/src/QMCHamiltonians/MomentumEstimator.cpp" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/MomentumEstimator.cpp.o" "gcc" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/MomentumEstimator.cpp.o.d"
+  "/root/repo/src/QMCHamiltonians/NonLocalECPComponent.cpp" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/NonLocalECPComponent.cpp.o" "gcc" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/NonLocalECPComponent.cpp.o.d"
+  "/root/repo/src/QMCHamiltonians/NonLocalECPotential.cpp" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/NonLocalECPotential.cpp.o" "gcc" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/NonLocalECPotential.cpp.o.d"
+  "/root/repo/src/QMCHamiltonians/NonLocalECPotential.deriv.cpp" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/NonLocalECPotential.deriv.cpp.o" "gcc" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/NonLocalECPotential.deriv.cpp.o.d"
+  "/root/repo/src/QMCHamiltonians/NonLocalTOperator.cpp" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/NonLocalTOperator.cpp.o" "gcc" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/NonLocalTOperator.cpp.o.d"
+  "/root/repo/src/QMCHamiltonians/OperatorBase.cpp" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/OperatorBase.cpp.o" "gcc" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/OperatorBase.cpp.o.d"
+  "/root/repo/src/QMCHamiltonians/OrbitalImages.cpp" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/OrbitalImages.cpp.o" "gcc" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/OrbitalImages.cpp.o.d"
+  "/root/repo/src/QMCHamiltonians/PairCorrEstimator.cpp" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/PairCorrEstimator.cpp.o" "gcc" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/PairCorrEstimator.cpp.o.d"
+  "/root/repo/src/QMCHamiltonians/QMCHamiltonian.cpp" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/QMCHamiltonian.cpp.o" "gcc" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/QMCHamiltonian.cpp.o.d"
+  "/root/repo/src/QMCHamiltonians/ReferencePoints.cpp" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/ReferencePoints.cpp.o" "gcc" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/ReferencePoints.cpp.o.d"
+  "/root/repo/src/QMCHamiltonians/SOECPComponent.cpp" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/SOECPComponent.cpp.o" "gcc" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/SOECPComponent.cpp.o.d"
+  "/root/repo/src/QMCHamiltonians/SOECPotential.cpp" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/SOECPotential.cpp.o" "gcc" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/SOECPotential.cpp.o.d"
+  "/root/repo/src/QMCHamiltonians/SkAllEstimator.cpp" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/SkAllEstimator.cpp.o" "gcc" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/SkAllEstimator.cpp.o.d"
+  "/root/repo/src/QMCHamiltonians/SkEstimator.cpp" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/SkEstimator.cpp.o" "gcc" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/SkEstimator.cpp.o.d"
+  "/root/repo/src/QMCHamiltonians/SkPot.cpp" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/SkPot.cpp.o" "gcc" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/SkPot.cpp.o.d"
+  "/root/repo/src/QMCHamiltonians/SpaceGrid.cpp" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/SpaceGrid.cpp.o" "gcc" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/SpaceGrid.cpp.o.d"
+  "/root/repo/src/QMCHamiltonians/SpeciesKineticEnergy.cpp" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/SpeciesKineticEnergy.cpp.o" "gcc" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/SpeciesKineticEnergy.cpp.o.d"
+  "/root/repo/src/QMCHamiltonians/SpinDensity.cpp" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/SpinDensity.cpp.o" "gcc" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/SpinDensity.cpp.o.d"
+  "/root/repo/src/QMCHamiltonians/StaticStructureFactor.cpp" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/StaticStructureFactor.cpp.o" "gcc" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/StaticStructureFactor.cpp.o.d"
+  "/root/repo/src/Estimators/TraceManager.cpp" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/__/Estimators/TraceManager.cpp.o" "gcc" "src/QMCHamiltonians/CMakeFiles/qmcham.dir/__/Estimators/TraceManager.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_complex_build/src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/einspline/CMakeFiles/einspline.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Particle/CMakeFiles/qmcparticle.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/CMakeFiles/qmcutil.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Containers/CMakeFiles/containers.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/CMakeFiles/platform_device.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Message/CMakeFiles/message.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/CMakeFiles/platform_host.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/CPU/CMakeFiles/platform_cpu.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/OpenMP/CMakeFiles/platform_omp.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,99 @@
+file(REMOVE_RECURSE
+  "../../lib/libqmcham.a"
+  "../../lib/libqmcham.pdb"
+  "CMakeFiles/qmcham.dir/ACForce.cpp.o"
+  "CMakeFiles/qmcham.dir/ACForce.cpp.o.d"
+  "CMakeFiles/qmcham.dir/ChiesaCorrection.cpp.o"
+  "CMakeFiles/qmcham.dir/ChiesaCorrection.cpp.o.d"
+  "CMakeFiles/qmcham.dir/CoulombPBCAA.cpp.o"
+  "CMakeFiles/qmcham.dir/CoulombPBCAA.cpp.o.d"
+  "CMakeFiles/qmcham.dir/CoulombPBCAB.cpp.o"
+  "CMakeFiles/qmcham.dir/CoulombPBCAB.cpp.o.d"
+  "CMakeFiles/qmcham.dir/CoulombPotentialFactory.cpp.o"
+  "CMakeFiles/qmcham.dir/CoulombPotentialFactory.cpp.o.d"
+  "CMakeFiles/qmcham.dir/DensityEstimator.cpp.o"
+  "CMakeFiles/qmcham.dir/DensityEstimator.cpp.o.d"
+  "CMakeFiles/qmcham.dir/DensityMatrices1B.cpp.o"
+  "CMakeFiles/qmcham.dir/DensityMatrices1B.cpp.o.d"
+  "CMakeFiles/qmcham.dir/ECPComponentBuilder.1.cpp.o"
+  "CMakeFiles/qmcham.dir/ECPComponentBuilder.1.cpp.o.d"
+  "CMakeFiles/qmcham.dir/ECPComponentBuilder.2.cpp.o"
+  "CMakeFiles/qmcham.dir/ECPComponentBuilder.2.cpp.o.d"
+  "CMakeFiles/qmcham.dir/ECPComponentBuilder.cpp.o"
+  "CMakeFiles/qmcham.dir/ECPComponentBuilder.cpp.o.d"
+  "CMakeFiles/qmcham.dir/ECPComponentBuilder_L2.cpp.o"
+  "CMakeFiles/qmcham.dir/ECPComponentBuilder_L2.cpp.o.d"
+  "CMakeFiles/qmcham.dir/ECPotentialBuilder.cpp.o"
+  "CMakeFiles/qmcham.dir/ECPotentialBuilder.cpp.o.d"
+  "CMakeFiles/qmcham.dir/EnergyDensityEstimator.cpp.o"
+  "CMakeFiles/qmcham.dir/EnergyDensityEstimator.cpp.o.d"
+  "CMakeFiles/qmcham.dir/ForceBase.cpp.o"
+  "CMakeFiles/qmcham.dir/ForceBase.cpp.o.d"
+  "CMakeFiles/qmcham.dir/ForceCeperley.cpp.o"
+  "CMakeFiles/qmcham.dir/ForceCeperley.cpp.o.d"
+  "CMakeFiles/qmcham.dir/ForceChiesaPBCAA.cpp.o"
+  "CMakeFiles/qmcham.dir/ForceChiesaPBCAA.cpp.o.d"
+  "CMakeFiles/qmcham.dir/ForwardWalking.cpp.o"
+  "CMakeFiles/qmcham.dir/ForwardWalking.cpp.o.d"
+  "CMakeFiles/qmcham.dir/GridExternalPotential.cpp.o"
+  "CMakeFiles/qmcham.dir/GridExternalPotential.cpp.o.d"
+  "CMakeFiles/qmcham.dir/HamiltonianFactory.cpp.o"
+  "CMakeFiles/qmcham.dir/HamiltonianFactory.cpp.o.d"
+  "CMakeFiles/qmcham.dir/HamiltonianPool.cpp.o"
+  "CMakeFiles/qmcham.dir/HamiltonianPool.cpp.o.d"
+  "CMakeFiles/qmcham.dir/HarmonicExternalPotential.cpp.o"
+  "CMakeFiles/qmcham.dir/HarmonicExternalPotential.cpp.o.d"
+  "CMakeFiles/qmcham.dir/L2Potential.cpp.o"
+  "CMakeFiles/qmcham.dir/L2Potential.cpp.o.d"
+  "CMakeFiles/qmcham.dir/LatticeDeviationEstimator.cpp.o"
+  "CMakeFiles/qmcham.dir/LatticeDeviationEstimator.cpp.o.d"
+  "CMakeFiles/qmcham.dir/LocalECPotential.cpp.o"
+  "CMakeFiles/qmcham.dir/LocalECPotential.cpp.o.d"
+  "CMakeFiles/qmcham.dir/MPC.cpp.o"
+  "CMakeFiles/qmcham.dir/MPC.cpp.o.d"
+  "CMakeFiles/qmcham.dir/MomentumEstimator.cpp.o"
+  "CMakeFiles/qmcham.dir/MomentumEstimator.cpp.o.d"
+  "CMakeFiles/qmcham.dir/NonLocalECPComponent.cpp.o"
+  "CMakeFiles/qmcham.dir/NonLocalECPComponent.cpp.o.d"
+  "CMakeFiles/qmcham.dir/NonLocalECPotential.cpp.o"
+  "CMakeFiles/qmcham.dir/NonLocalECPotential.cpp.o.d"
+  "CMakeFiles/qmcham.dir/NonLocalECPotential.deriv.cpp.o"
+  "CMakeFiles/qmcham.dir/NonLocalECPotential.deriv.cpp.o.d"
+  "CMakeFiles/qmcham.dir/NonLocalTOperator.cpp.o"
+  "CMakeFiles/qmcham.dir/NonLocalTOperator.cpp.o.d"
+  "CMakeFiles/qmcham.dir/OperatorBase.cpp.o"
+  "CMakeFiles/qmcham.dir/OperatorBase.cpp.o.d"
+  "CMakeFiles/qmcham.dir/OrbitalImages.cpp.o"
+  "CMakeFiles/qmcham.dir/OrbitalImages.cpp.o.d"
+  "CMakeFiles/qmcham.dir/PairCorrEstimator.cpp.o"
+  "CMakeFiles/qmcham.dir/PairCorrEstimator.cpp.o.d"
+  "CMakeFiles/qmcham.dir/QMCHamiltonian.cpp.o"
+  "CMakeFiles/qmcham.dir/QMCHamiltonian.cpp.o.d"
+  "CMakeFiles/qmcham.dir/ReferencePoints.cpp.o"
+  "CMakeFiles/qmcham.dir/ReferencePoints.cpp.o.d"
+  "CMakeFiles/qmcham.dir/SOECPComponent.cpp.o"
+  "CMakeFiles/qmcham.dir/SOECPComponent.cpp.o.d"
+  "CMakeFiles/qmcham.dir/SOECPotential.cpp.o"
+  "CMakeFiles/qmcham.dir/SOECPotential.cpp.o.d"
+  "CMakeFiles/qmcham.dir/SkAllEstimator.cpp.o"
+  "CMakeFiles/qmcham.dir/SkAllEstimator.cpp.o.d"
+  "CMakeFiles/qmcham.dir/SkEstimator.cpp.o"
+  "CMakeFiles/qmcham.dir/SkEstimator.cpp.o.d"
+  "CMakeFiles/qmcham.dir/SkPot.cpp.o"
+  "CMakeFiles/qmcham.dir/SkPot.cpp.o.d"
+  "CMakeFiles/qmcham.dir/SpaceGrid.cpp.o"
+  "CMakeFiles/qmcham.dir/SpaceGrid.cpp.o.d"
+  "CMakeFiles/qmcham.dir/SpeciesKineticEnergy.cpp.o"
+  "CMakeFiles/qmcham.dir/SpeciesKineticEnergy.cpp.o.d"
+  "CMakeFiles/qmcham.dir/SpinDensity.cpp.o"
+  "CMakeFiles/qmcham.dir/SpinDensity.cpp.o.d"
+  "CMakeFiles/qmcham.dir/StaticStructureFactor.cpp.o"
+  "CMakeFiles/qmcham.dir/StaticStructureFactor.cpp.o.d"
+  "CMakeFiles/qmcham.dir/__/Estimators/TraceManager.cpp.o"
+  "CMakeFiles/qmcham.dir/__/Estimators/TraceManager.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/qmcham.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,99 @@
+file(REMOVE_RECURSE
+  "../../lib/libqmcham_unit.a"
+  "../../lib/libqmcham_unit.pdb"
+  "CMakeFiles/qmcham_unit.dir/ACForce.cpp.o"
+  "CMakeFiles/qmcham_unit.dir/ACForce.cpp.o.d"
+  "CMakeFiles/qmcham_unit.dir/ChiesaCorrection.cpp.o"
+  "CMakeFiles/qmcham_unit.dir/ChiesaCorrection.cpp.o.d"
+  "CMakeFiles/qmcham_unit.dir/CoulombPBCAA.cpp.o"
+  "CMakeFiles/qmcham_unit.dir/CoulombPBCAA.cpp.o.d"
+  "CMakeFiles/qmcham_unit.dir/CoulombPBCAB.cpp.o"
+  "CMakeFiles/qmcham_unit.dir/CoulombPBCAB.cpp.o.d"
+  "CMakeFiles/qmcham_unit.dir/CoulombPotentialFactory.cpp.o"
+  "CMakeFiles/qmcham_unit.dir/CoulombPotentialFactory.cpp.o.d"
+  "CMakeFiles/qmcham_unit.dir/DensityEstimator.cpp.o"
+  "CMakeFiles/qmcham_unit.dir/DensityEstimator.cpp.o.d"
+  "CMakeFiles/qmcham_unit.dir/DensityMatrices1B.cpp.o"
+  "CMakeFiles/qmcham_unit.dir/DensityMatrices1B.cpp.o.d"
+  "CMakeFiles/qmcham_unit.dir/ECPComponentBuilder.1.cpp.o"
+  "CMakeFiles/qmcham_unit.dir/ECPComponentBuilder.1.cpp.o.d"
+  "CMakeFiles/qmcham_unit.dir/ECPComponentBuilder.2.cpp.o"
+  "CMakeFiles/qmcham_unit.dir/ECPComponentBuilder.2.cpp.o.d"
+  "CMakeFiles/qmcham_unit.dir/ECPComponentBuilder.cpp.o"
+  "CMakeFiles/qmcham_unit.dir/ECPComponentBuilder.cpp.o.d"
+  "CMakeFiles/qmcham_unit.dir/ECPComponentBuilder_L2.cpp.o"
+  "CMakeFiles/qmcham_unit.dir/ECPComponentBuilder_L2.cpp.o.d"
+  "CMakeFiles/qmcham_unit.dir/ECPotentialBuilder.cpp.o"
+  "CMakeFiles/qmcham_unit.dir/ECPotentialBuilder.cpp.o.d"
+  "CMakeFiles/qmcham_unit.dir/EnergyDensityEstimator.cpp.o"
+  "CMakeFiles/qmcham_unit.dir/EnergyDensityEstimator.cpp.o.d"
+  "CMakeFiles/qmcham_unit.dir/ForceBase.cpp.o"
+  "CMakeFiles/qmcham_unit.dir/ForceBase.cpp.o.d"
+  "CMakeFiles/qmcham_unit.dir/ForceCeperley.cpp.o"
+  "CMakeFiles/qmcham_unit.dir/ForceCeperley.cpp.o.d"
+  "CMakeFiles/qmcham_unit.dir/ForceChiesaPBCAA.cpp.o"
+  "CMakeFiles/qmcham_unit.dir/ForceChiesaPBCAA.cpp.o.d"
+  "CMakeFiles/qmcham_unit.dir/ForwardWalking.cpp.o"
+  "CMakeFiles/qmcham_unit.dir/ForwardWalking.cpp.o.d"
+  "CMakeFiles/qmcham_unit.dir/GridExternalPotential.cpp.o"
+  "CMakeFiles/qmcham_unit.dir/GridExternalPotential.cpp.o.d"
+  "CMakeFiles/qmcham_unit.dir/HamiltonianFactory.cpp.o"
+  "CMakeFiles/qmcham_unit.dir/HamiltonianFactory.cpp.o.d"
+  "CMakeFiles/qmcham_unit.dir/HamiltonianPool.cpp.o"
+  "CMakeFiles/qmcham_unit.dir/HamiltonianPool.cpp.o.d"
+  "CMakeFiles/qmcham_unit.dir/HarmonicExternalPotential.cpp.o"
+  "CMakeFiles/qmcham_unit.dir/HarmonicExternalPotential.cpp.o.d"
+  "CMakeFiles/qmcham_unit.dir/L2Potential.cpp.o"
+  "CMakeFiles/qmcham_unit.dir/L2Potential.cpp.o.d"
+  "CMakeFiles/qmcham_unit.dir/LatticeDeviationEstimator.cpp.o"
+  "CMakeFiles/qmcham_unit.dir/LatticeDeviationEstimator.cpp.o.d"
+  "CMakeFiles/qmcham_unit.dir/LocalECPotential.cpp.o"
+  "CMakeFiles/qmcham_unit.dir/LocalECPotential.cpp.o.d"
+  "CMakeFiles/qmcham_unit.dir/MPC.cpp.o"
+  "CMakeFiles/qmcham_unit.dir/MPC.cpp.o.d"
+  "CMakeFiles/qmcham_unit.dir/MomentumEstimator.cpp.o"
+  "CMakeFiles/qmcham_unit.dir/MomentumEstimator.cpp.o.d"
+  "CMakeFiles/qmcham_unit.dir/NonLocalECPComponent.cpp.o"
+  "CMakeFiles/qmcham_unit.dir/NonLocalECPComponent.cpp.o.d"
+  "CMakeFiles/qmcham_unit.dir/NonLocalECPotential.cpp.o"
+  "CMakeFiles/qmcham_unit.dir/NonLocalECPotential.cpp.o.d"
+  "CMakeFiles/qmcham_unit.dir/NonLocalECPotential.deriv.cpp.o"
+  "CMakeFiles/qmcham_unit.dir/NonLocalECPotential.deriv.cpp.o.d"
+  "CMakeFiles/qmcham_unit.dir/NonLocalTOperator.cpp.o"
+  "CMakeFiles/qmcham_unit.dir/NonLocalTOperator.cpp.o.d"
+  "CMakeFiles/qmcham_unit.dir/OperatorBase.cpp.o"
+  "CMakeFiles/qmcham_unit.dir/OperatorBase.cpp.o.d"
+  "CMakeFiles/qmcham_unit.dir/OrbitalImages.cpp.o"
+  "CMakeFiles/qmcham_unit.dir/OrbitalImages.cpp.o.d"
+  "CMakeFiles/qmcham_unit.dir/PairCorrEstimator.cpp.o"
+  "CMakeFiles/qmcham_unit.dir/PairCorrEstimator.cpp.o.d"
+  "CMakeFiles/qmcham_unit.dir/QMCHamiltonian.cpp.o"
+  "CMakeFiles/qmcham_unit.dir/QMCHamiltonian.cpp.o.d"
+  "CMakeFiles/qmcham_unit.dir/ReferencePoints.cpp.o"
+  "CMakeFiles/qmcham_unit.dir/ReferencePoints.cpp.o.d"
+  "CMakeFiles/qmcham_unit.dir/SOECPComponent.cpp.o"
+  "CMakeFiles/qmcham_unit.dir/SOECPComponent.cpp.o.d"
+  "CMakeFiles/qmcham_unit.dir/SOECPotential.cpp.o"
+  "CMakeFiles/qmcham_unit.dir/SOECPotential.cpp.o.d"
+  "CMakeFiles/qmcham_unit.dir/SkAllEstimator.cpp.o"
+  "CMakeFiles/qmcham_unit.dir/SkAllEstimator.cpp.o.d"
+  "CMakeFiles/qmcham_unit.dir/SkEstimator.cpp.o"
+  "CMakeFiles/qmcham_unit.dir/SkEstimator.cpp.o.d"
+  "CMakeFiles/qmcham_unit.dir/SkPot.cpp.o"
+  "CMakeFiles/qmcham_unit.dir/SkPot.cpp.o.d"
+  "CMakeFiles/qmcham_unit.dir/SpaceGrid.cpp.o"
+  "CMakeFiles/qmcham_unit.dir/SpaceGrid.cpp.o.d"
+  "CMakeFiles/qmcham_unit.dir/SpeciesKineticEnergy.cpp.o"
+  "CMakeFiles/qmcham_unit.dir/SpeciesKineticEnergy.cpp.o.d"
+  "CMakeFiles/qmcham_unit.dir/SpinDensity.cpp.o"
+  "CMakeFiles/qmcham_unit.dir/SpinDensity.cpp.o.d"
+  "CMakeFiles/qmcham_unit.dir/StaticStructureFactor.cpp.o"
+  "CMakeFiles/qmcham_unit.dir/StaticStructureFactor.cpp.o.d"
+  "CMakeFiles/qmcham_unit.dir/__/Estimators/TraceManager.cpp.o"
+  "CMakeFiles/qmcham_unit.dir/__/Estimators/TraceManager.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/qmcham_unit.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
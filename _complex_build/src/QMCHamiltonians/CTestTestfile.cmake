@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/QMCHamiltonians
+# Build directory: /root/repo/_complex_build/src/QMCHamiltonians
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
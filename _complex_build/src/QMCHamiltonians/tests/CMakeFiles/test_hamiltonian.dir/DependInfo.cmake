@@ -0,0 +1,45 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/QMCHamiltonians/tests/test_MomentumEstimator.cpp" "src/QMCHamiltonians/tests/CMakeFiles/test_hamiltonian.dir/test_MomentumEstimator.cpp.o" "gcc" "src/QMCHamiltonians/tests/CMakeFiles/test_hamiltonian.dir/test_MomentumEstimator.cpp.o.d"
+  "/root/repo/src/QMCHamiltonians/tests/test_PairCorrEstimator.cpp" "src/QMCHamiltonians/tests/CMakeFiles/test_hamiltonian.dir/test_PairCorrEstimator.cpp.o" "gcc" "src/QMCHamiltonians/tests/CMakeFiles/test_hamiltonian.dir/test_PairCorrEstimator.cpp.o.d"
+  "/root/repo/src/QMCHamiltonians/tests/test_QMCHamiltonian.cpp" "src/QMCHamiltonians/tests/CMakeFiles/test_hamiltonian.dir/test_QMCHamiltonian.cpp.o" "gcc" "src/QMCHamiltonians/tests/CMakeFiles/test_hamiltonian.dir/test_QMCHamiltonian.cpp.o.d"
+  "/root/repo/src/QMCHamiltonians/tests/test_SkAllEstimator.cpp" "src/QMCHamiltonians/tests/CMakeFiles/test_hamiltonian.dir/test_SkAllEstimator.cpp.o" "gcc" "src/QMCHamiltonians/tests/CMakeFiles/test_hamiltonian.dir/test_SkAllEstimator.cpp.o.d"
+  "/root/repo/src/QMCHamiltonians/tests/test_SpaceGrid.cpp" "src/QMCHamiltonians/tests/CMakeFiles/test_hamiltonian.dir/test_SpaceGrid.cpp.o" "gcc" "src/QMCHamiltonians/tests/CMakeFiles/test_hamiltonian.dir/test_SpaceGrid.cpp.o.d"
+  "/root/repo/src/QMCHamiltonians/tests/test_bare_kinetic.cpp" "src/QMCHamiltonians/tests/CMakeFiles/test_hamiltonian.dir/test_bare_kinetic.cpp.o" "gcc" "src/QMCHamiltonians/tests/CMakeFiles/test_hamiltonian.dir/test_bare_kinetic.cpp.o.d"
+  "/root/repo/src/QMCHamiltonians/tests/test_coulomb_pbcAA.cpp" "src/QMCHamiltonians/tests/CMakeFiles/test_hamiltonian.dir/test_coulomb_pbcAA.cpp.o" "gcc" "src/QMCHamiltonians/tests/CMakeFiles/test_hamiltonian.dir/test_coulomb_pbcAA.cpp.o.d"
+  "/root/repo/src/QMCHamiltonians/tests/test_coulomb_pbcAA_ewald.cpp" "src/QMCHamiltonians/tests/CMakeFiles/test_hamiltonian.dir/test_coulomb_pbcAA_ewald.cpp.o" "gcc" "src/QMCHamiltonians/tests/CMakeFiles/test_hamiltonian.dir/test_coulomb_pbcAA_ewald.cpp.o.d"
+  "/root/repo/src/QMCHamiltonians/tests/test_coulomb_pbcAB.cpp" "src/QMCHamiltonians/tests/CMakeFiles/test_hamiltonian.dir/test_coulomb_pbcAB.cpp.o" "gcc" "src/QMCHamiltonians/tests/CMakeFiles/test_hamiltonian.dir/test_coulomb_pbcAB.cpp.o.d"
+  "/root/repo/src/QMCHamiltonians/tests/test_coulomb_pbcAB_ewald.cpp" "src/QMCHamiltonians/tests/CMakeFiles/test_hamiltonian.dir/test_coulomb_pbcAB_ewald.cpp.o" "gcc" "src/QMCHamiltonians/tests/CMakeFiles/test_hamiltonian.dir/test_coulomb_pbcAB_ewald.cpp.o.d"
+  "/root/repo/src/QMCHamiltonians/tests/test_ecp.cpp" "src/QMCHamiltonians/tests/CMakeFiles/test_hamiltonian.dir/test_ecp.cpp.o" "gcc" "src/QMCHamiltonians/tests/CMakeFiles/test_hamiltonian.dir/test_ecp.cpp.o.d"
+  "/root/repo/src/QMCHamiltonians/tests/test_force.cpp" "src/QMCHamiltonians/tests/CMakeFiles/test_hamiltonian.dir/test_force.cpp.o" "gcc" "src/QMCHamiltonians/tests/CMakeFiles/test_hamiltonian.dir/test_force.cpp.o.d"
+  "/root/repo/src/QMCHamiltonians/tests/test_force_ewald.cpp" "src/QMCHamiltonians/tests/CMakeFiles/test_hamiltonian.dir/test_force_ewald.cpp.o" "gcc" "src/QMCHamiltonians/tests/CMakeFiles/test_hamiltonian.dir/test_force_ewald.cpp.o.d"
+  "/root/repo/src/QMCHamiltonians/tests/test_hamiltonian_factory.cpp" "src/QMCHamiltonians/tests/CMakeFiles/test_hamiltonian.dir/test_hamiltonian_factory.cpp.o" "gcc" "src/QMCHamiltonians/tests/CMakeFiles/test_hamiltonian.dir/test_hamiltonian_factory.cpp.o.d"
+  "/root/repo/src/QMCHamiltonians/tests/test_hamiltonian_pool.cpp" "src/QMCHamiltonians/tests/CMakeFiles/test_hamiltonian.dir/test_hamiltonian_pool.cpp.o" "gcc" "src/QMCHamiltonians/tests/CMakeFiles/test_hamiltonian.dir/test_hamiltonian_pool.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_complex_build/src/Message/CMakeFiles/catch_main.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/QMCHamiltonians/CMakeFiles/qmcham.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Particle/CMakeFiles/qmcparticle.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/CMakeFiles/qmcutil.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Containers/CMakeFiles/containers.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/CMakeFiles/platform_device.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Message/CMakeFiles/message.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/CMakeFiles/platform_host.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/CPU/CMakeFiles/platform_cpu.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/OpenMP/CMakeFiles/platform_omp.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/einspline/CMakeFiles/einspline.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,39 @@
+file(REMOVE_RECURSE
+  "../../../tests/bin/test_hamiltonian"
+  "../../../tests/bin/test_hamiltonian.pdb"
+  "CMakeFiles/test_hamiltonian.dir/test_MomentumEstimator.cpp.o"
+  "CMakeFiles/test_hamiltonian.dir/test_MomentumEstimator.cpp.o.d"
+  "CMakeFiles/test_hamiltonian.dir/test_PairCorrEstimator.cpp.o"
+  "CMakeFiles/test_hamiltonian.dir/test_PairCorrEstimator.cpp.o.d"
+  "CMakeFiles/test_hamiltonian.dir/test_QMCHamiltonian.cpp.o"
+  "CMakeFiles/test_hamiltonian.dir/test_QMCHamiltonian.cpp.o.d"
+  "CMakeFiles/test_hamiltonian.dir/test_SkAllEstimator.cpp.o"
+  "CMakeFiles/test_hamiltonian.dir/test_SkAllEstimator.cpp.o.d"
+  "CMakeFiles/test_hamiltonian.dir/test_SpaceGrid.cpp.o"
+  "CMakeFiles/test_hamiltonian.dir/test_SpaceGrid.cpp.o.d"
+  "CMakeFiles/test_hamiltonian.dir/test_bare_kinetic.cpp.o"
+  "CMakeFiles/test_hamiltonian.dir/test_bare_kinetic.cpp.o.d"
+  "CMakeFiles/test_hamiltonian.dir/test_coulomb_pbcAA.cpp.o"
+  "CMakeFiles/test_hamiltonian.dir/test_coulomb_pbcAA.cpp.o.d"
+  "CMakeFiles/test_hamiltonian.dir/test_coulomb_pbcAA_ewald.cpp.o"
+  "CMakeFiles/test_hamiltonian.dir/test_coulomb_pbcAA_ewald.cpp.o.d"
+  "CMakeFiles/test_hamiltonian.dir/test_coulomb_pbcAB.cpp.o"
+  "CMakeFiles/test_hamiltonian.dir/test_coulomb_pbcAB.cpp.o.d"
+  "CMakeFiles/test_hamiltonian.dir/test_coulomb_pbcAB_ewald.cpp.o"
+  "CMakeFiles/test_hamiltonian.dir/test_coulomb_pbcAB_ewald.cpp.o.d"
+  "CMakeFiles/test_hamiltonian.dir/test_ecp.cpp.o"
+  "CMakeFiles/test_hamiltonian.dir/test_ecp.cpp.o.d"
+  "CMakeFiles/test_hamiltonian.dir/test_force.cpp.o"
+  "CMakeFiles/test_hamiltonian.dir/test_force.cpp.o.d"
+  "CMakeFiles/test_hamiltonian.dir/test_force_ewald.cpp.o"
+  "CMakeFiles/test_hamiltonian.dir/test_force_ewald.cpp.o.d"
+  "CMakeFiles/test_hamiltonian.dir/test_hamiltonian_factory.cpp.o"
+  "CMakeFiles/test_hamiltonian.dir/test_hamiltonian_factory.cpp.o.d"
+  "CMakeFiles/test_hamiltonian.dir/test_hamiltonian_pool.cpp.o"
+  "CMakeFiles/test_hamiltonian.dir/test_hamiltonian_pool.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_hamiltonian.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/QMCHamiltonians/tests
+# Build directory: /root/repo/_complex_build/src/QMCHamiltonians/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(deterministic-unit_test_hamiltonian "/root/repo/_complex_build/tests/bin/test_hamiltonian")
+set_tests_properties(deterministic-unit_test_hamiltonian PROPERTIES  LABELS "quality_unknown;deterministic;unit" WORKING_DIRECTORY "/root/repo/_complex_build/tests/hamiltonians" _BACKTRACE_TRIPLES "/root/repo/CMake/unit_test.cmake;11;ADD_TEST;/root/repo/src/QMCHamiltonians/tests/CMakeLists.txt;63;ADD_UNIT_TEST;/root/repo/src/QMCHamiltonians/tests/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/convert4qmc"
+  "../../bin/convert4qmc.pdb"
+  "CMakeFiles/convert4qmc.dir/convert4qmc.cpp.o"
+  "CMakeFiles/convert4qmc.dir/convert4qmc.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/convert4qmc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
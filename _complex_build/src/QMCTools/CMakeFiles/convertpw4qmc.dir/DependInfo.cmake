@@ -0,0 +1,28 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/QMCTools/WriteEshdf.cpp" "src/QMCTools/CMakeFiles/convertpw4qmc.dir/WriteEshdf.cpp.o" "gcc" "src/QMCTools/CMakeFiles/convertpw4qmc.dir/WriteEshdf.cpp.o.d"
+  "/root/repo/src/QMCTools/XmlRep.cpp" "src/QMCTools/CMakeFiles/convertpw4qmc.dir/XmlRep.cpp.o" "gcc" "src/QMCTools/CMakeFiles/convertpw4qmc.dir/XmlRep.cpp.o.d"
+  "/root/repo/src/QMCTools/convertpw4qmc.cpp" "src/QMCTools/CMakeFiles/convertpw4qmc.dir/convertpw4qmc.cpp.o" "gcc" "src/QMCTools/CMakeFiles/convertpw4qmc.dir/convertpw4qmc.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_complex_build/src/CMakeFiles/qmcutil.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Containers/CMakeFiles/containers.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/CMakeFiles/platform_device.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Message/CMakeFiles/message.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/CMakeFiles/platform_host.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/CPU/CMakeFiles/platform_cpu.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/OpenMP/CMakeFiles/platform_omp.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../bin/convertpw4qmc"
+  "../../bin/convertpw4qmc.pdb"
+  "CMakeFiles/convertpw4qmc.dir/WriteEshdf.cpp.o"
+  "CMakeFiles/convertpw4qmc.dir/WriteEshdf.cpp.o.d"
+  "CMakeFiles/convertpw4qmc.dir/XmlRep.cpp.o"
+  "CMakeFiles/convertpw4qmc.dir/XmlRep.cpp.o.d"
+  "CMakeFiles/convertpw4qmc.dir/convertpw4qmc.cpp.o"
+  "CMakeFiles/convertpw4qmc.dir/convertpw4qmc.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/convertpw4qmc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
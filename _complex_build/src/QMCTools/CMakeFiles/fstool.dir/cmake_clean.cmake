@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "../../lib/libfstool.a"
+  "../../lib/libfstool.pdb"
+  "CMakeFiles/fstool.dir/QMCFiniteSize/FSUtilities.cpp.o"
+  "CMakeFiles/fstool.dir/QMCFiniteSize/FSUtilities.cpp.o.d"
+  "CMakeFiles/fstool.dir/QMCFiniteSize/QMCFiniteSize.cpp.o"
+  "CMakeFiles/fstool.dir/QMCFiniteSize/QMCFiniteSize.cpp.o.d"
+  "CMakeFiles/fstool.dir/QMCFiniteSize/SkParserASCII.cpp.o"
+  "CMakeFiles/fstool.dir/QMCFiniteSize/SkParserASCII.cpp.o.d"
+  "CMakeFiles/fstool.dir/QMCFiniteSize/SkParserBase.cpp.o"
+  "CMakeFiles/fstool.dir/QMCFiniteSize/SkParserBase.cpp.o.d"
+  "CMakeFiles/fstool.dir/QMCFiniteSize/SkParserHDF5.cpp.o"
+  "CMakeFiles/fstool.dir/QMCFiniteSize/SkParserHDF5.cpp.o.d"
+  "CMakeFiles/fstool.dir/QMCFiniteSize/SkParserScalarDat.cpp.o"
+  "CMakeFiles/fstool.dir/QMCFiniteSize/SkParserScalarDat.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fstool.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
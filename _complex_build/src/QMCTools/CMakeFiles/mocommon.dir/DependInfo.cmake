@@ -0,0 +1,36 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/QMCTools/BMakeFunc.cpp" "src/QMCTools/CMakeFiles/mocommon.dir/BMakeFunc.cpp.o" "gcc" "src/QMCTools/CMakeFiles/mocommon.dir/BMakeFunc.cpp.o.d"
+  "/root/repo/src/QMCTools/BParser.cpp" "src/QMCTools/CMakeFiles/mocommon.dir/BParser.cpp.o" "gcc" "src/QMCTools/CMakeFiles/mocommon.dir/BParser.cpp.o.d"
+  "/root/repo/src/QMCTools/CasinoParser.cpp" "src/QMCTools/CMakeFiles/mocommon.dir/CasinoParser.cpp.o" "gcc" "src/QMCTools/CMakeFiles/mocommon.dir/CasinoParser.cpp.o.d"
+  "/root/repo/src/QMCTools/GamesAsciiParser.cpp" "src/QMCTools/CMakeFiles/mocommon.dir/GamesAsciiParser.cpp.o" "gcc" "src/QMCTools/CMakeFiles/mocommon.dir/GamesAsciiParser.cpp.o.d"
+  "/root/repo/src/QMCTools/GamesFMOParser.cpp" "src/QMCTools/CMakeFiles/mocommon.dir/GamesFMOParser.cpp.o" "gcc" "src/QMCTools/CMakeFiles/mocommon.dir/GamesFMOParser.cpp.o.d"
+  "/root/repo/src/QMCTools/GamesXmlParser.cpp" "src/QMCTools/CMakeFiles/mocommon.dir/GamesXmlParser.cpp.o" "gcc" "src/QMCTools/CMakeFiles/mocommon.dir/GamesXmlParser.cpp.o.d"
+  "/root/repo/src/QMCTools/GaussianFCHKParser.cpp" "src/QMCTools/CMakeFiles/mocommon.dir/GaussianFCHKParser.cpp.o" "gcc" "src/QMCTools/CMakeFiles/mocommon.dir/GaussianFCHKParser.cpp.o.d"
+  "/root/repo/src/QMCTools/LCAOHDFParser.cpp" "src/QMCTools/CMakeFiles/mocommon.dir/LCAOHDFParser.cpp.o" "gcc" "src/QMCTools/CMakeFiles/mocommon.dir/LCAOHDFParser.cpp.o.d"
+  "/root/repo/src/QMCTools/QMCGaussianParserBase.cpp" "src/QMCTools/CMakeFiles/mocommon.dir/QMCGaussianParserBase.cpp.o" "gcc" "src/QMCTools/CMakeFiles/mocommon.dir/QMCGaussianParserBase.cpp.o.d"
+  "/root/repo/src/QMCTools/QPParser.cpp" "src/QMCTools/CMakeFiles/mocommon.dir/QPParser.cpp.o" "gcc" "src/QMCTools/CMakeFiles/mocommon.dir/QPParser.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_complex_build/src/Particle/CMakeFiles/qmcparticle.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/CMakeFiles/qmcutil.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Containers/CMakeFiles/containers.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/CMakeFiles/platform_device.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Message/CMakeFiles/message.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/CMakeFiles/platform_host.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/CPU/CMakeFiles/platform_cpu.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/OpenMP/CMakeFiles/platform_omp.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
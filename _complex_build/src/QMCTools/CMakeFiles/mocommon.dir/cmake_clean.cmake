@@ -0,0 +1,29 @@
+file(REMOVE_RECURSE
+  "../../lib/libmocommon.a"
+  "../../lib/libmocommon.pdb"
+  "CMakeFiles/mocommon.dir/BMakeFunc.cpp.o"
+  "CMakeFiles/mocommon.dir/BMakeFunc.cpp.o.d"
+  "CMakeFiles/mocommon.dir/BParser.cpp.o"
+  "CMakeFiles/mocommon.dir/BParser.cpp.o.d"
+  "CMakeFiles/mocommon.dir/CasinoParser.cpp.o"
+  "CMakeFiles/mocommon.dir/CasinoParser.cpp.o.d"
+  "CMakeFiles/mocommon.dir/GamesAsciiParser.cpp.o"
+  "CMakeFiles/mocommon.dir/GamesAsciiParser.cpp.o.d"
+  "CMakeFiles/mocommon.dir/GamesFMOParser.cpp.o"
+  "CMakeFiles/mocommon.dir/GamesFMOParser.cpp.o.d"
+  "CMakeFiles/mocommon.dir/GamesXmlParser.cpp.o"
+  "CMakeFiles/mocommon.dir/GamesXmlParser.cpp.o.d"
+  "CMakeFiles/mocommon.dir/GaussianFCHKParser.cpp.o"
+  "CMakeFiles/mocommon.dir/GaussianFCHKParser.cpp.o.d"
+  "CMakeFiles/mocommon.dir/LCAOHDFParser.cpp.o"
+  "CMakeFiles/mocommon.dir/LCAOHDFParser.cpp.o.d"
+  "CMakeFiles/mocommon.dir/QMCGaussianParserBase.cpp.o"
+  "CMakeFiles/mocommon.dir/QMCGaussianParserBase.cpp.o.d"
+  "CMakeFiles/mocommon.dir/QPParser.cpp.o"
+  "CMakeFiles/mocommon.dir/QPParser.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mocommon.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
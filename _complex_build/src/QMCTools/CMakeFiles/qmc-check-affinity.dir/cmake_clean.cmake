@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/qmc-check-affinity"
+  "../../bin/qmc-check-affinity.pdb"
+  "CMakeFiles/qmc-check-affinity.dir/check-affinity.cpp.o"
+  "CMakeFiles/qmc-check-affinity.dir/check-affinity.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/qmc-check-affinity.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
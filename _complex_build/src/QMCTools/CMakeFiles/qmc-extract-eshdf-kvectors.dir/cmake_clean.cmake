@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/qmc-extract-eshdf-kvectors"
+  "../../bin/qmc-extract-eshdf-kvectors.pdb"
+  "CMakeFiles/qmc-extract-eshdf-kvectors.dir/qmc-extract-eshdf-kvectors.cpp.o"
+  "CMakeFiles/qmc-extract-eshdf-kvectors.dir/qmc-extract-eshdf-kvectors.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/qmc-extract-eshdf-kvectors.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
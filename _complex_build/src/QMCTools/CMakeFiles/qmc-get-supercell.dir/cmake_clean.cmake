@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/qmc-get-supercell"
+  "../../bin/qmc-get-supercell.pdb"
+  "CMakeFiles/qmc-get-supercell.dir/getSupercell.cpp.o"
+  "CMakeFiles/qmc-get-supercell.dir/getSupercell.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/qmc-get-supercell.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
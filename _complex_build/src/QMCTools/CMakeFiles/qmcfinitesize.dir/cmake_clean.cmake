@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/qmcfinitesize"
+  "../../bin/qmcfinitesize.pdb"
+  "CMakeFiles/qmcfinitesize.dir/qmcfinitesize.cpp.o"
+  "CMakeFiles/qmcfinitesize.dir/qmcfinitesize.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/qmcfinitesize.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
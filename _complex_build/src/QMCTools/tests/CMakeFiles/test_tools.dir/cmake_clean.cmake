@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../tests/bin/test_tools"
+  "../../../tests/bin/test_tools.pdb"
+  "CMakeFiles/test_tools.dir/test_qmcfstool.cpp.o"
+  "CMakeFiles/test_tools.dir/test_qmcfstool.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_tools.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,89 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/QMCWaveFunctions/AtomicOrbital.cpp" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/AtomicOrbital.cpp.o" "gcc" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/AtomicOrbital.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/BandInfo.cpp" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/BandInfo.cpp.o" "gcc" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/BandInfo.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/BsplineFactory/BsplineReaderBase.cpp" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/BsplineFactory/BsplineReaderBase.cpp.o" "gcc" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/BsplineFactory/BsplineReaderBase.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/BsplineFactory/SplineC2C.cpp" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/BsplineFactory/SplineC2C.cpp.o" "gcc" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/BsplineFactory/SplineC2C.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/BsplineFactory/createComplexDouble.cpp" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/BsplineFactory/createComplexDouble.cpp.o" "gcc" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/BsplineFactory/createComplexDouble.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/BsplineFactory/createComplexSingle.cpp" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/BsplineFactory/createComplexSingle.cpp.o" "gcc" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/BsplineFactory/createComplexSingle.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/CompositeSPOSet.cpp" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/CompositeSPOSet.cpp.o" "gcc" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/CompositeSPOSet.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/DiffWaveFunctionComponent.cpp" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/DiffWaveFunctionComponent.cpp.o" "gcc" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/DiffWaveFunctionComponent.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/EinsplineSet.cpp" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/EinsplineSet.cpp.o" "gcc" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/EinsplineSet.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/EinsplineSetBuilderCommon.cpp" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/EinsplineSetBuilderCommon.cpp.o" "gcc" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/EinsplineSetBuilderCommon.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/EinsplineSetBuilderESHDF.fft.cpp" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/EinsplineSetBuilderESHDF.fft.cpp.o" "gcc" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/EinsplineSetBuilderESHDF.fft.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/EinsplineSetBuilderOld.cpp" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/EinsplineSetBuilderOld.cpp.o" "gcc" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/EinsplineSetBuilderOld.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/EinsplineSetBuilderReadBands_ESHDF.cpp" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/EinsplineSetBuilderReadBands_ESHDF.cpp.o" "gcc" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/EinsplineSetBuilderReadBands_ESHDF.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/EinsplineSetBuilder_createSPOs.cpp" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/EinsplineSetBuilder_createSPOs.cpp.o" "gcc" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/EinsplineSetBuilder_createSPOs.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/EinsplineSpinorSetBuilder.cpp" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/EinsplineSpinorSetBuilder.cpp.o" "gcc" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/EinsplineSpinorSetBuilder.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/ElectronGas/ElectronGasComplexOrbitalBuilder.cpp" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/ElectronGas/ElectronGasComplexOrbitalBuilder.cpp.o" "gcc" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/ElectronGas/ElectronGasComplexOrbitalBuilder.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/ExampleHeBuilder.cpp" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/ExampleHeBuilder.cpp.o" "gcc" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/ExampleHeBuilder.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/ExampleHeComponent.cpp" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/ExampleHeComponent.cpp.o" "gcc" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/ExampleHeComponent.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/Fermion/BackflowBuilder.cpp" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/Fermion/BackflowBuilder.cpp.o" "gcc" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/Fermion/BackflowBuilder.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/Fermion/DiracDeterminant.cpp" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/Fermion/DiracDeterminant.cpp.o" "gcc" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/Fermion/DiracDeterminant.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/Fermion/DiracDeterminantBatched.cpp" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/Fermion/DiracDeterminantBatched.cpp.o" "gcc" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/Fermion/DiracDeterminantBatched.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/Fermion/DiracDeterminantWithBackflow.cpp" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/Fermion/DiracDeterminantWithBackflow.cpp.o" "gcc" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/Fermion/DiracDeterminantWithBackflow.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/Fermion/MultiDiracDeterminant.2.cpp" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/Fermion/MultiDiracDeterminant.2.cpp.o" "gcc" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/Fermion/MultiDiracDeterminant.2.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/Fermion/MultiDiracDeterminant.cpp" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/Fermion/MultiDiracDeterminant.cpp.o" "gcc" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/Fermion/MultiDiracDeterminant.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/Fermion/MultiSlaterDeterminant.cpp" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/Fermion/MultiSlaterDeterminant.cpp.o" "gcc" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/Fermion/MultiSlaterDeterminant.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/Fermion/MultiSlaterDeterminantFast.cpp" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/Fermion/MultiSlaterDeterminantFast.cpp.o" "gcc" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/Fermion/MultiSlaterDeterminantFast.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/Fermion/MultiSlaterDeterminantWithBackflow.cpp" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/Fermion/MultiSlaterDeterminantWithBackflow.cpp.o" "gcc" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/Fermion/MultiSlaterDeterminantWithBackflow.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/Fermion/SPOSetProxy.cpp" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/Fermion/SPOSetProxy.cpp.o" "gcc" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/Fermion/SPOSetProxy.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/Fermion/SPOSetProxyForMSD.cpp" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/Fermion/SPOSetProxyForMSD.cpp.o" "gcc" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/Fermion/SPOSetProxyForMSD.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/Fermion/SlaterDet.cpp" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/Fermion/SlaterDet.cpp.o" "gcc" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/Fermion/SlaterDet.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/Fermion/SlaterDetBuilder.cpp" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/Fermion/SlaterDetBuilder.cpp.o" "gcc" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/Fermion/SlaterDetBuilder.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/Fermion/SlaterDetWithBackflow.cpp" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/Fermion/SlaterDetWithBackflow.cpp.o" "gcc" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/Fermion/SlaterDetWithBackflow.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/HarmonicOscillator/SHOSet.cpp" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/HarmonicOscillator/SHOSet.cpp.o" "gcc" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/HarmonicOscillator/SHOSet.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/HarmonicOscillator/SHOSetBuilder.cpp" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/HarmonicOscillator/SHOSetBuilder.cpp.o" "gcc" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/HarmonicOscillator/SHOSetBuilder.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/Jastrow/CountingJastrowBuilder.cpp" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/Jastrow/CountingJastrowBuilder.cpp.o" "gcc" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/Jastrow/CountingJastrowBuilder.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/Jastrow/JastrowBuilder.cpp" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/Jastrow/JastrowBuilder.cpp.o" "gcc" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/Jastrow/JastrowBuilder.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/Jastrow/RPAJastrow.cpp" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/Jastrow/RPAJastrow.cpp.o" "gcc" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/Jastrow/RPAJastrow.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/Jastrow/RadialJastrowBuilder.cpp" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/Jastrow/RadialJastrowBuilder.cpp.o" "gcc" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/Jastrow/RadialJastrowBuilder.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/Jastrow/eeI_JastrowBuilder.cpp" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/Jastrow/eeI_JastrowBuilder.cpp.o" "gcc" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/Jastrow/eeI_JastrowBuilder.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/Jastrow/kSpaceJastrow.cpp" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/Jastrow/kSpaceJastrow.cpp.o" "gcc" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/Jastrow/kSpaceJastrow.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/Jastrow/kSpaceJastrowBuilder.cpp" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/Jastrow/kSpaceJastrowBuilder.cpp.o" "gcc" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/Jastrow/kSpaceJastrowBuilder.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/LatticeGaussianProduct.cpp" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/LatticeGaussianProduct.cpp.o" "gcc" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/LatticeGaussianProduct.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/LatticeGaussianProductBuilder.cpp" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/LatticeGaussianProductBuilder.cpp.o" "gcc" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/LatticeGaussianProductBuilder.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/MuffinTin.cpp" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/MuffinTin.cpp.o" "gcc" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/MuffinTin.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/PlaneWave/PWBasis.cpp" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/PlaneWave/PWBasis.cpp.o" "gcc" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/PlaneWave/PWBasis.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/PlaneWave/PWOrbitalBuilder.cpp" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/PlaneWave/PWOrbitalBuilder.cpp.o" "gcc" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/PlaneWave/PWOrbitalBuilder.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/PlaneWave/PWOrbitalSet.cpp" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/PlaneWave/PWOrbitalSet.cpp.o" "gcc" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/PlaneWave/PWOrbitalSet.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/PlaneWave/PWParameterSet.cpp" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/PlaneWave/PWParameterSet.cpp.o" "gcc" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/PlaneWave/PWParameterSet.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/SPOInfo.cpp" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/SPOInfo.cpp.o" "gcc" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/SPOInfo.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/SPOSet.cpp" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/SPOSet.cpp.o" "gcc" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/SPOSet.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/SPOSetBuilder.cpp" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/SPOSetBuilder.cpp.o" "gcc" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/SPOSetBuilder.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/SPOSetBuilderFactory.cpp" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/SPOSetBuilderFactory.cpp.o" "gcc" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/SPOSetBuilderFactory.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/SPOSetInfo.cpp" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/SPOSetInfo.cpp.o" "gcc" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/SPOSetInfo.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/SPOSetInputInfo.cpp" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/SPOSetInputInfo.cpp.o" "gcc" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/SPOSetInputInfo.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/SpinorSet.cpp" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/SpinorSet.cpp.o" "gcc" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/SpinorSet.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/TrialWaveFunction.cpp" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/TrialWaveFunction.cpp.o" "gcc" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/TrialWaveFunction.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/WaveFunctionComponent.cpp" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/WaveFunctionComponent.cpp.o" "gcc" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/WaveFunctionComponent.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/WaveFunctionComponentBuilder.cpp" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/WaveFunctionComponentBuilder.cpp.o" "gcc" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/WaveFunctionComponentBuilder.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/WaveFunctionFactory.cpp" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/WaveFunctionFactory.cpp.o" "gcc" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/WaveFunctionFactory.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/WaveFunctionPool.cpp" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/WaveFunctionPool.cpp.o" "gcc" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/WaveFunctionPool.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/lcao/LCAOrbitalBuilder.cpp" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/lcao/LCAOrbitalBuilder.cpp.o" "gcc" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/lcao/LCAOrbitalBuilder.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/lcao/LCAOrbitalSet.cpp" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/lcao/LCAOrbitalSet.cpp.o" "gcc" "src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/lcao/LCAOrbitalSet.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_complex_build/src/Particle/CMakeFiles/qmcparticle.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/CMakeFiles/platform_device.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/einspline/CMakeFiles/einspline.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/CMakeFiles/qmcutil.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Containers/CMakeFiles/containers.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Message/CMakeFiles/message.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/CMakeFiles/platform_host.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/CPU/CMakeFiles/platform_cpu.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/OpenMP/CMakeFiles/platform_omp.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
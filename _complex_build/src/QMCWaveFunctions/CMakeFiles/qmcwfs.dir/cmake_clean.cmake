@@ -0,0 +1,133 @@
+file(REMOVE_RECURSE
+  "../../lib/libqmcwfs.a"
+  "../../lib/libqmcwfs.pdb"
+  "CMakeFiles/qmcwfs.dir/AtomicOrbital.cpp.o"
+  "CMakeFiles/qmcwfs.dir/AtomicOrbital.cpp.o.d"
+  "CMakeFiles/qmcwfs.dir/BandInfo.cpp.o"
+  "CMakeFiles/qmcwfs.dir/BandInfo.cpp.o.d"
+  "CMakeFiles/qmcwfs.dir/BsplineFactory/BsplineReaderBase.cpp.o"
+  "CMakeFiles/qmcwfs.dir/BsplineFactory/BsplineReaderBase.cpp.o.d"
+  "CMakeFiles/qmcwfs.dir/BsplineFactory/SplineC2C.cpp.o"
+  "CMakeFiles/qmcwfs.dir/BsplineFactory/SplineC2C.cpp.o.d"
+  "CMakeFiles/qmcwfs.dir/BsplineFactory/createComplexDouble.cpp.o"
+  "CMakeFiles/qmcwfs.dir/BsplineFactory/createComplexDouble.cpp.o.d"
+  "CMakeFiles/qmcwfs.dir/BsplineFactory/createComplexSingle.cpp.o"
+  "CMakeFiles/qmcwfs.dir/BsplineFactory/createComplexSingle.cpp.o.d"
+  "CMakeFiles/qmcwfs.dir/CompositeSPOSet.cpp.o"
+  "CMakeFiles/qmcwfs.dir/CompositeSPOSet.cpp.o.d"
+  "CMakeFiles/qmcwfs.dir/DiffWaveFunctionComponent.cpp.o"
+  "CMakeFiles/qmcwfs.dir/DiffWaveFunctionComponent.cpp.o.d"
+  "CMakeFiles/qmcwfs.dir/EinsplineSet.cpp.o"
+  "CMakeFiles/qmcwfs.dir/EinsplineSet.cpp.o.d"
+  "CMakeFiles/qmcwfs.dir/EinsplineSetBuilderCommon.cpp.o"
+  "CMakeFiles/qmcwfs.dir/EinsplineSetBuilderCommon.cpp.o.d"
+  "CMakeFiles/qmcwfs.dir/EinsplineSetBuilderESHDF.fft.cpp.o"
+  "CMakeFiles/qmcwfs.dir/EinsplineSetBuilderESHDF.fft.cpp.o.d"
+  "CMakeFiles/qmcwfs.dir/EinsplineSetBuilderOld.cpp.o"
+  "CMakeFiles/qmcwfs.dir/EinsplineSetBuilderOld.cpp.o.d"
+  "CMakeFiles/qmcwfs.dir/EinsplineSetBuilderReadBands_ESHDF.cpp.o"
+  "CMakeFiles/qmcwfs.dir/EinsplineSetBuilderReadBands_ESHDF.cpp.o.d"
+  "CMakeFiles/qmcwfs.dir/EinsplineSetBuilder_createSPOs.cpp.o"
+  "CMakeFiles/qmcwfs.dir/EinsplineSetBuilder_createSPOs.cpp.o.d"
+  "CMakeFiles/qmcwfs.dir/EinsplineSpinorSetBuilder.cpp.o"
+  "CMakeFiles/qmcwfs.dir/EinsplineSpinorSetBuilder.cpp.o.d"
+  "CMakeFiles/qmcwfs.dir/ElectronGas/ElectronGasComplexOrbitalBuilder.cpp.o"
+  "CMakeFiles/qmcwfs.dir/ElectronGas/ElectronGasComplexOrbitalBuilder.cpp.o.d"
+  "CMakeFiles/qmcwfs.dir/ExampleHeBuilder.cpp.o"
+  "CMakeFiles/qmcwfs.dir/ExampleHeBuilder.cpp.o.d"
+  "CMakeFiles/qmcwfs.dir/ExampleHeComponent.cpp.o"
+  "CMakeFiles/qmcwfs.dir/ExampleHeComponent.cpp.o.d"
+  "CMakeFiles/qmcwfs.dir/Fermion/BackflowBuilder.cpp.o"
+  "CMakeFiles/qmcwfs.dir/Fermion/BackflowBuilder.cpp.o.d"
+  "CMakeFiles/qmcwfs.dir/Fermion/DiracDeterminant.cpp.o"
+  "CMakeFiles/qmcwfs.dir/Fermion/DiracDeterminant.cpp.o.d"
+  "CMakeFiles/qmcwfs.dir/Fermion/DiracDeterminantBatched.cpp.o"
+  "CMakeFiles/qmcwfs.dir/Fermion/DiracDeterminantBatched.cpp.o.d"
+  "CMakeFiles/qmcwfs.dir/Fermion/DiracDeterminantWithBackflow.cpp.o"
+  "CMakeFiles/qmcwfs.dir/Fermion/DiracDeterminantWithBackflow.cpp.o.d"
+  "CMakeFiles/qmcwfs.dir/Fermion/MultiDiracDeterminant.2.cpp.o"
+  "CMakeFiles/qmcwfs.dir/Fermion/MultiDiracDeterminant.2.cpp.o.d"
+  "CMakeFiles/qmcwfs.dir/Fermion/MultiDiracDeterminant.cpp.o"
+  "CMakeFiles/qmcwfs.dir/Fermion/MultiDiracDeterminant.cpp.o.d"
+  "CMakeFiles/qmcwfs.dir/Fermion/MultiSlaterDeterminant.cpp.o"
+  "CMakeFiles/qmcwfs.dir/Fermion/MultiSlaterDeterminant.cpp.o.d"
+  "CMakeFiles/qmcwfs.dir/Fermion/MultiSlaterDeterminantFast.cpp.o"
+  "CMakeFiles/qmcwfs.dir/Fermion/MultiSlaterDeterminantFast.cpp.o.d"
+  "CMakeFiles/qmcwfs.dir/Fermion/MultiSlaterDeterminantWithBackflow.cpp.o"
+  "CMakeFiles/qmcwfs.dir/Fermion/MultiSlaterDeterminantWithBackflow.cpp.o.d"
+  "CMakeFiles/qmcwfs.dir/Fermion/SPOSetProxy.cpp.o"
+  "CMakeFiles/qmcwfs.dir/Fermion/SPOSetProxy.cpp.o.d"
+  "CMakeFiles/qmcwfs.dir/Fermion/SPOSetProxyForMSD.cpp.o"
+  "CMakeFiles/qmcwfs.dir/Fermion/SPOSetProxyForMSD.cpp.o.d"
+  "CMakeFiles/qmcwfs.dir/Fermion/SlaterDet.cpp.o"
+  "CMakeFiles/qmcwfs.dir/Fermion/SlaterDet.cpp.o.d"
+  "CMakeFiles/qmcwfs.dir/Fermion/SlaterDetBuilder.cpp.o"
+  "CMakeFiles/qmcwfs.dir/Fermion/SlaterDetBuilder.cpp.o.d"
+  "CMakeFiles/qmcwfs.dir/Fermion/SlaterDetWithBackflow.cpp.o"
+  "CMakeFiles/qmcwfs.dir/Fermion/SlaterDetWithBackflow.cpp.o.d"
+  "CMakeFiles/qmcwfs.dir/HarmonicOscillator/SHOSet.cpp.o"
+  "CMakeFiles/qmcwfs.dir/HarmonicOscillator/SHOSet.cpp.o.d"
+  "CMakeFiles/qmcwfs.dir/HarmonicOscillator/SHOSetBuilder.cpp.o"
+  "CMakeFiles/qmcwfs.dir/HarmonicOscillator/SHOSetBuilder.cpp.o.d"
+  "CMakeFiles/qmcwfs.dir/Jastrow/CountingJastrowBuilder.cpp.o"
+  "CMakeFiles/qmcwfs.dir/Jastrow/CountingJastrowBuilder.cpp.o.d"
+  "CMakeFiles/qmcwfs.dir/Jastrow/JastrowBuilder.cpp.o"
+  "CMakeFiles/qmcwfs.dir/Jastrow/JastrowBuilder.cpp.o.d"
+  "CMakeFiles/qmcwfs.dir/Jastrow/RPAJastrow.cpp.o"
+  "CMakeFiles/qmcwfs.dir/Jastrow/RPAJastrow.cpp.o.d"
+  "CMakeFiles/qmcwfs.dir/Jastrow/RadialJastrowBuilder.cpp.o"
+  "CMakeFiles/qmcwfs.dir/Jastrow/RadialJastrowBuilder.cpp.o.d"
+  "CMakeFiles/qmcwfs.dir/Jastrow/eeI_JastrowBuilder.cpp.o"
+  "CMakeFiles/qmcwfs.dir/Jastrow/eeI_JastrowBuilder.cpp.o.d"
+  "CMakeFiles/qmcwfs.dir/Jastrow/kSpaceJastrow.cpp.o"
+  "CMakeFiles/qmcwfs.dir/Jastrow/kSpaceJastrow.cpp.o.d"
+  "CMakeFiles/qmcwfs.dir/Jastrow/kSpaceJastrowBuilder.cpp.o"
+  "CMakeFiles/qmcwfs.dir/Jastrow/kSpaceJastrowBuilder.cpp.o.d"
+  "CMakeFiles/qmcwfs.dir/LatticeGaussianProduct.cpp.o"
+  "CMakeFiles/qmcwfs.dir/LatticeGaussianProduct.cpp.o.d"
+  "CMakeFiles/qmcwfs.dir/LatticeGaussianProductBuilder.cpp.o"
+  "CMakeFiles/qmcwfs.dir/LatticeGaussianProductBuilder.cpp.o.d"
+  "CMakeFiles/qmcwfs.dir/MuffinTin.cpp.o"
+  "CMakeFiles/qmcwfs.dir/MuffinTin.cpp.o.d"
+  "CMakeFiles/qmcwfs.dir/PlaneWave/PWBasis.cpp.o"
+  "CMakeFiles/qmcwfs.dir/PlaneWave/PWBasis.cpp.o.d"
+  "CMakeFiles/qmcwfs.dir/PlaneWave/PWOrbitalBuilder.cpp.o"
+  "CMakeFiles/qmcwfs.dir/PlaneWave/PWOrbitalBuilder.cpp.o.d"
+  "CMakeFiles/qmcwfs.dir/PlaneWave/PWOrbitalSet.cpp.o"
+  "CMakeFiles/qmcwfs.dir/PlaneWave/PWOrbitalSet.cpp.o.d"
+  "CMakeFiles/qmcwfs.dir/PlaneWave/PWParameterSet.cpp.o"
+  "CMakeFiles/qmcwfs.dir/PlaneWave/PWParameterSet.cpp.o.d"
+  "CMakeFiles/qmcwfs.dir/SPOInfo.cpp.o"
+  "CMakeFiles/qmcwfs.dir/SPOInfo.cpp.o.d"
+  "CMakeFiles/qmcwfs.dir/SPOSet.cpp.o"
+  "CMakeFiles/qmcwfs.dir/SPOSet.cpp.o.d"
+  "CMakeFiles/qmcwfs.dir/SPOSetBuilder.cpp.o"
+  "CMakeFiles/qmcwfs.dir/SPOSetBuilder.cpp.o.d"
+  "CMakeFiles/qmcwfs.dir/SPOSetBuilderFactory.cpp.o"
+  "CMakeFiles/qmcwfs.dir/SPOSetBuilderFactory.cpp.o.d"
+  "CMakeFiles/qmcwfs.dir/SPOSetInfo.cpp.o"
+  "CMakeFiles/qmcwfs.dir/SPOSetInfo.cpp.o.d"
+  "CMakeFiles/qmcwfs.dir/SPOSetInputInfo.cpp.o"
+  "CMakeFiles/qmcwfs.dir/SPOSetInputInfo.cpp.o.d"
+  "CMakeFiles/qmcwfs.dir/SpinorSet.cpp.o"
+  "CMakeFiles/qmcwfs.dir/SpinorSet.cpp.o.d"
+  "CMakeFiles/qmcwfs.dir/TrialWaveFunction.cpp.o"
+  "CMakeFiles/qmcwfs.dir/TrialWaveFunction.cpp.o.d"
+  "CMakeFiles/qmcwfs.dir/WaveFunctionComponent.cpp.o"
+  "CMakeFiles/qmcwfs.dir/WaveFunctionComponent.cpp.o.d"
+  "CMakeFiles/qmcwfs.dir/WaveFunctionComponentBuilder.cpp.o"
+  "CMakeFiles/qmcwfs.dir/WaveFunctionComponentBuilder.cpp.o.d"
+  "CMakeFiles/qmcwfs.dir/WaveFunctionFactory.cpp.o"
+  "CMakeFiles/qmcwfs.dir/WaveFunctionFactory.cpp.o.d"
+  "CMakeFiles/qmcwfs.dir/WaveFunctionPool.cpp.o"
+  "CMakeFiles/qmcwfs.dir/WaveFunctionPool.cpp.o.d"
+  "CMakeFiles/qmcwfs.dir/lcao/LCAOrbitalBuilder.cpp.o"
+  "CMakeFiles/qmcwfs.dir/lcao/LCAOrbitalBuilder.cpp.o.d"
+  "CMakeFiles/qmcwfs.dir/lcao/LCAOrbitalSet.cpp.o"
+  "CMakeFiles/qmcwfs.dir/lcao/LCAOrbitalSet.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/qmcwfs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,54 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/QMCWaveFunctions/tests/FakeSPO.cpp" "src/QMCWaveFunctions/tests/CMakeFiles/test_wavefunction.dir/FakeSPO.cpp.o" "gcc" "src/QMCWaveFunctions/tests/CMakeFiles/test_wavefunction.dir/FakeSPO.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/tests/test_DiracDeterminantBatched.cpp" "src/QMCWaveFunctions/tests/CMakeFiles/test_wavefunction.dir/test_DiracDeterminantBatched.cpp.o" "gcc" "src/QMCWaveFunctions/tests/CMakeFiles/test_wavefunction.dir/test_DiracDeterminantBatched.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/tests/test_TrialWaveFunction.cpp" "src/QMCWaveFunctions/tests/CMakeFiles/test_wavefunction.dir/test_TrialWaveFunction.cpp.o" "gcc" "src/QMCWaveFunctions/tests/CMakeFiles/test_wavefunction.dir/test_TrialWaveFunction.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/tests/test_TrialWaveFunction_He.cpp" "src/QMCWaveFunctions/tests/CMakeFiles/test_wavefunction.dir/test_TrialWaveFunction_He.cpp.o" "gcc" "src/QMCWaveFunctions/tests/CMakeFiles/test_wavefunction.dir/test_TrialWaveFunction_He.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/tests/test_TrialWaveFunction_diamondC_2x1x1.cpp" "src/QMCWaveFunctions/tests/CMakeFiles/test_wavefunction.dir/test_TrialWaveFunction_diamondC_2x1x1.cpp.o" "gcc" "src/QMCWaveFunctions/tests/CMakeFiles/test_wavefunction.dir/test_TrialWaveFunction_diamondC_2x1x1.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/tests/test_bspline_jastrow.cpp" "src/QMCWaveFunctions/tests/CMakeFiles/test_wavefunction.dir/test_bspline_jastrow.cpp.o" "gcc" "src/QMCWaveFunctions/tests/CMakeFiles/test_wavefunction.dir/test_bspline_jastrow.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/tests/test_counting_jastrow.cpp" "src/QMCWaveFunctions/tests/CMakeFiles/test_wavefunction.dir/test_counting_jastrow.cpp.o" "gcc" "src/QMCWaveFunctions/tests/CMakeFiles/test_wavefunction.dir/test_counting_jastrow.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/tests/test_dirac_det.cpp" "src/QMCWaveFunctions/tests/CMakeFiles/test_wavefunction.dir/test_dirac_det.cpp.o" "gcc" "src/QMCWaveFunctions/tests/CMakeFiles/test_wavefunction.dir/test_dirac_det.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/tests/test_dirac_matrix.cpp" "src/QMCWaveFunctions/tests/CMakeFiles/test_wavefunction.dir/test_dirac_matrix.cpp.o" "gcc" "src/QMCWaveFunctions/tests/CMakeFiles/test_wavefunction.dir/test_dirac_matrix.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/tests/test_einset.cpp" "src/QMCWaveFunctions/tests/CMakeFiles/test_wavefunction.dir/test_einset.cpp.o" "gcc" "src/QMCWaveFunctions/tests/CMakeFiles/test_wavefunction.dir/test_einset.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/tests/test_einset_spinor.cpp" "src/QMCWaveFunctions/tests/CMakeFiles/test_wavefunction.dir/test_einset_spinor.cpp.o" "gcc" "src/QMCWaveFunctions/tests/CMakeFiles/test_wavefunction.dir/test_einset_spinor.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/tests/test_example_he.cpp" "src/QMCWaveFunctions/tests/CMakeFiles/test_wavefunction.dir/test_example_he.cpp.o" "gcc" "src/QMCWaveFunctions/tests/CMakeFiles/test_wavefunction.dir/test_example_he.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/tests/test_hybridrep.cpp" "src/QMCWaveFunctions/tests/CMakeFiles/test_wavefunction.dir/test_hybridrep.cpp.o" "gcc" "src/QMCWaveFunctions/tests/CMakeFiles/test_wavefunction.dir/test_hybridrep.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/tests/test_kspace_jastrow.cpp" "src/QMCWaveFunctions/tests/CMakeFiles/test_wavefunction.dir/test_kspace_jastrow.cpp.o" "gcc" "src/QMCWaveFunctions/tests/CMakeFiles/test_wavefunction.dir/test_kspace_jastrow.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/tests/test_lattice_gaussian.cpp" "src/QMCWaveFunctions/tests/CMakeFiles/test_wavefunction.dir/test_lattice_gaussian.cpp.o" "gcc" "src/QMCWaveFunctions/tests/CMakeFiles/test_wavefunction.dir/test_lattice_gaussian.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/tests/test_multi_dirac_determinant.cpp" "src/QMCWaveFunctions/tests/CMakeFiles/test_wavefunction.dir/test_multi_dirac_determinant.cpp.o" "gcc" "src/QMCWaveFunctions/tests/CMakeFiles/test_wavefunction.dir/test_multi_dirac_determinant.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/tests/test_polynomial_eeI_jastrow.cpp" "src/QMCWaveFunctions/tests/CMakeFiles/test_wavefunction.dir/test_polynomial_eeI_jastrow.cpp.o" "gcc" "src/QMCWaveFunctions/tests/CMakeFiles/test_wavefunction.dir/test_polynomial_eeI_jastrow.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/tests/test_pw.cpp" "src/QMCWaveFunctions/tests/CMakeFiles/test_wavefunction.dir/test_pw.cpp.o" "gcc" "src/QMCWaveFunctions/tests/CMakeFiles/test_wavefunction.dir/test_pw.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/tests/test_pyscf_complex_MO.cpp" "src/QMCWaveFunctions/tests/CMakeFiles/test_wavefunction.dir/test_pyscf_complex_MO.cpp.o" "gcc" "src/QMCWaveFunctions/tests/CMakeFiles/test_wavefunction.dir/test_pyscf_complex_MO.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/tests/test_rpa_jastrow.cpp" "src/QMCWaveFunctions/tests/CMakeFiles/test_wavefunction.dir/test_rpa_jastrow.cpp.o" "gcc" "src/QMCWaveFunctions/tests/CMakeFiles/test_wavefunction.dir/test_rpa_jastrow.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/tests/test_short_range_cusp_jastrow.cpp" "src/QMCWaveFunctions/tests/CMakeFiles/test_wavefunction.dir/test_short_range_cusp_jastrow.cpp.o" "gcc" "src/QMCWaveFunctions/tests/CMakeFiles/test_wavefunction.dir/test_short_range_cusp_jastrow.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/tests/test_user_jastrow.cpp" "src/QMCWaveFunctions/tests/CMakeFiles/test_wavefunction.dir/test_user_jastrow.cpp.o" "gcc" "src/QMCWaveFunctions/tests/CMakeFiles/test_wavefunction.dir/test_user_jastrow.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/tests/test_wavefunction_factory.cpp" "src/QMCWaveFunctions/tests/CMakeFiles/test_wavefunction.dir/test_wavefunction_factory.cpp.o" "gcc" "src/QMCWaveFunctions/tests/CMakeFiles/test_wavefunction.dir/test_wavefunction_factory.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/tests/test_wavefunction_pool.cpp" "src/QMCWaveFunctions/tests/CMakeFiles/test_wavefunction.dir/test_wavefunction_pool.cpp.o" "gcc" "src/QMCWaveFunctions/tests/CMakeFiles/test_wavefunction.dir/test_wavefunction_pool.cpp.o.d"
+  "/root/repo/src/QMCWaveFunctions/tests/test_wf.cpp" "src/QMCWaveFunctions/tests/CMakeFiles/test_wavefunction.dir/test_wf.cpp.o" "gcc" "src/QMCWaveFunctions/tests/CMakeFiles/test_wavefunction.dir/test_wf.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_complex_build/src/Message/CMakeFiles/catch_main.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/QMCWaveFunctions/CMakeFiles/qmcwfs.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Particle/CMakeFiles/qmcparticle.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/CMakeFiles/qmcutil.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Containers/CMakeFiles/containers.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/CMakeFiles/platform_device.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Message/CMakeFiles/message.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/CMakeFiles/platform_host.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/CPU/CMakeFiles/platform_cpu.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/OpenMP/CMakeFiles/platform_omp.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/einspline/CMakeFiles/einspline.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,59 @@
+file(REMOVE_RECURSE
+  "../../../tests/bin/test_wavefunction"
+  "../../../tests/bin/test_wavefunction.pdb"
+  "CMakeFiles/test_wavefunction.dir/FakeSPO.cpp.o"
+  "CMakeFiles/test_wavefunction.dir/FakeSPO.cpp.o.d"
+  "CMakeFiles/test_wavefunction.dir/test_DiracDeterminantBatched.cpp.o"
+  "CMakeFiles/test_wavefunction.dir/test_DiracDeterminantBatched.cpp.o.d"
+  "CMakeFiles/test_wavefunction.dir/test_TrialWaveFunction.cpp.o"
+  "CMakeFiles/test_wavefunction.dir/test_TrialWaveFunction.cpp.o.d"
+  "CMakeFiles/test_wavefunction.dir/test_TrialWaveFunction_He.cpp.o"
+  "CMakeFiles/test_wavefunction.dir/test_TrialWaveFunction_He.cpp.o.d"
+  "CMakeFiles/test_wavefunction.dir/test_TrialWaveFunction_diamondC_2x1x1.cpp.o"
+  "CMakeFiles/test_wavefunction.dir/test_TrialWaveFunction_diamondC_2x1x1.cpp.o.d"
+  "CMakeFiles/test_wavefunction.dir/test_bspline_jastrow.cpp.o"
+  "CMakeFiles/test_wavefunction.dir/test_bspline_jastrow.cpp.o.d"
+  "CMakeFiles/test_wavefunction.dir/test_counting_jastrow.cpp.o"
+  "CMakeFiles/test_wavefunction.dir/test_counting_jastrow.cpp.o.d"
+  "CMakeFiles/test_wavefunction.dir/test_dirac_det.cpp.o"
+  "CMakeFiles/test_wavefunction.dir/test_dirac_det.cpp.o.d"
+  "CMakeFiles/test_wavefunction.dir/test_dirac_matrix.cpp.o"
+  "CMakeFiles/test_wavefunction.dir/test_dirac_matrix.cpp.o.d"
+  "CMakeFiles/test_wavefunction.dir/test_einset.cpp.o"
+  "CMakeFiles/test_wavefunction.dir/test_einset.cpp.o.d"
+  "CMakeFiles/test_wavefunction.dir/test_einset_spinor.cpp.o"
+  "CMakeFiles/test_wavefunction.dir/test_einset_spinor.cpp.o.d"
+  "CMakeFiles/test_wavefunction.dir/test_example_he.cpp.o"
+  "CMakeFiles/test_wavefunction.dir/test_example_he.cpp.o.d"
+  "CMakeFiles/test_wavefunction.dir/test_hybridrep.cpp.o"
+  "CMakeFiles/test_wavefunction.dir/test_hybridrep.cpp.o.d"
+  "CMakeFiles/test_wavefunction.dir/test_kspace_jastrow.cpp.o"
+  "CMakeFiles/test_wavefunction.dir/test_kspace_jastrow.cpp.o.d"
+  "CMakeFiles/test_wavefunction.dir/test_lattice_gaussian.cpp.o"
+  "CMakeFiles/test_wavefunction.dir/test_lattice_gaussian.cpp.o.d"
+  "CMakeFiles/test_wavefunction.dir/test_multi_dirac_determinant.cpp.o"
+  "CMakeFiles/test_wavefunction.dir/test_multi_dirac_determinant.cpp.o.d"
+  "CMakeFiles/test_wavefunction.dir/test_polynomial_eeI_jastrow.cpp.o"
+  "CMakeFiles/test_wavefunction.dir/test_polynomial_eeI_jastrow.cpp.o.d"
+  "CMakeFiles/test_wavefunction.dir/test_pw.cpp.o"
+  "CMakeFiles/test_wavefunction.dir/test_pw.cpp.o.d"
+  "CMakeFiles/test_wavefunction.dir/test_pyscf_complex_MO.cpp.o"
+  "CMakeFiles/test_wavefunction.dir/test_pyscf_complex_MO.cpp.o.d"
+  "CMakeFiles/test_wavefunction.dir/test_rpa_jastrow.cpp.o"
+  "CMakeFiles/test_wavefunction.dir/test_rpa_jastrow.cpp.o.d"
+  "CMakeFiles/test_wavefunction.dir/test_short_range_cusp_jastrow.cpp.o"
+  "CMakeFiles/test_wavefunction.dir/test_short_range_cusp_jastrow.cpp.o.d"
+  "CMakeFiles/test_wavefunction.dir/test_user_jastrow.cpp.o"
+  "CMakeFiles/test_wavefunction.dir/test_user_jastrow.cpp.o.d"
+  "CMakeFiles/test_wavefunction.dir/test_wavefunction_factory.cpp.o"
+  "CMakeFiles/test_wavefunction.dir/test_wavefunction_factory.cpp.o.d"
+  "CMakeFiles/test_wavefunction.dir/test_wavefunction_pool.cpp.o"
+  "CMakeFiles/test_wavefunction.dir/test_wavefunction_pool.cpp.o.d"
+  "CMakeFiles/test_wavefunction.dir/test_wf.cpp.o"
+  "CMakeFiles/test_wavefunction.dir/test_wf.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_wavefunction.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
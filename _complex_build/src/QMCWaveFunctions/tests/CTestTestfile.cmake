@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/QMCWaveFunctions/tests
+# Build directory: /root/repo/_complex_build/src/QMCWaveFunctions/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(deterministic-unit_test_wavefunction "/root/repo/_complex_build/tests/bin/test_wavefunction")
+set_tests_properties(deterministic-unit_test_wavefunction PROPERTIES  LABELS "quality_unknown;deterministic;unit" WORKING_DIRECTORY "/root/repo/_complex_build/tests/wavefunction" _BACKTRACE_TRIPLES "/root/repo/CMake/unit_test.cmake;11;ADD_TEST;/root/repo/src/QMCWaveFunctions/tests/CMakeLists.txt;64;ADD_UNIT_TEST;/root/repo/src/QMCWaveFunctions/tests/CMakeLists.txt;0;")
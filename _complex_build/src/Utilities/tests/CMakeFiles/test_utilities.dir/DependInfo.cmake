@@ -0,0 +1,34 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/Utilities/tests/test_infostream.cpp" "src/Utilities/tests/CMakeFiles/test_utilities.dir/test_infostream.cpp.o" "gcc" "src/Utilities/tests/CMakeFiles/test_utilities.dir/test_infostream.cpp.o.d"
+  "/root/repo/src/Utilities/tests/test_output_manager.cpp" "src/Utilities/tests/CMakeFiles/test_utilities.dir/test_output_manager.cpp.o" "gcc" "src/Utilities/tests/CMakeFiles/test_utilities.dir/test_output_manager.cpp.o.d"
+  "/root/repo/src/Utilities/tests/test_parser.cpp" "src/Utilities/tests/CMakeFiles/test_utilities.dir/test_parser.cpp.o" "gcc" "src/Utilities/tests/CMakeFiles/test_utilities.dir/test_parser.cpp.o.d"
+  "/root/repo/src/Utilities/tests/test_partition.cpp" "src/Utilities/tests/CMakeFiles/test_utilities.dir/test_partition.cpp.o" "gcc" "src/Utilities/tests/CMakeFiles/test_utilities.dir/test_partition.cpp.o.d"
+  "/root/repo/src/Utilities/tests/test_pooled_memory.cpp" "src/Utilities/tests/CMakeFiles/test_utilities.dir/test_pooled_memory.cpp.o" "gcc" "src/Utilities/tests/CMakeFiles/test_utilities.dir/test_pooled_memory.cpp.o.d"
+  "/root/repo/src/Utilities/tests/test_prime_set.cpp" "src/Utilities/tests/CMakeFiles/test_utilities.dir/test_prime_set.cpp.o" "gcc" "src/Utilities/tests/CMakeFiles/test_utilities.dir/test_prime_set.cpp.o.d"
+  "/root/repo/src/Utilities/tests/test_rng.cpp" "src/Utilities/tests/CMakeFiles/test_utilities.dir/test_rng.cpp.o" "gcc" "src/Utilities/tests/CMakeFiles/test_utilities.dir/test_rng.cpp.o.d"
+  "/root/repo/src/Utilities/tests/test_timer.cpp" "src/Utilities/tests/CMakeFiles/test_utilities.dir/test_timer.cpp.o" "gcc" "src/Utilities/tests/CMakeFiles/test_utilities.dir/test_timer.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_complex_build/src/Message/CMakeFiles/catch_main.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/CMakeFiles/qmcutil.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Containers/CMakeFiles/containers.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/CMakeFiles/platform_device.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Message/CMakeFiles/message.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/CMakeFiles/platform_host.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/CPU/CMakeFiles/platform_cpu.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/OpenMP/CMakeFiles/platform_omp.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "../../../tests/bin/test_utilities"
+  "../../../tests/bin/test_utilities.pdb"
+  "CMakeFiles/test_utilities.dir/test_infostream.cpp.o"
+  "CMakeFiles/test_utilities.dir/test_infostream.cpp.o.d"
+  "CMakeFiles/test_utilities.dir/test_output_manager.cpp.o"
+  "CMakeFiles/test_utilities.dir/test_output_manager.cpp.o.d"
+  "CMakeFiles/test_utilities.dir/test_parser.cpp.o"
+  "CMakeFiles/test_utilities.dir/test_parser.cpp.o.d"
+  "CMakeFiles/test_utilities.dir/test_partition.cpp.o"
+  "CMakeFiles/test_utilities.dir/test_partition.cpp.o.d"
+  "CMakeFiles/test_utilities.dir/test_pooled_memory.cpp.o"
+  "CMakeFiles/test_utilities.dir/test_pooled_memory.cpp.o.d"
+  "CMakeFiles/test_utilities.dir/test_prime_set.cpp.o"
+  "CMakeFiles/test_utilities.dir/test_prime_set.cpp.o.d"
+  "CMakeFiles/test_utilities.dir/test_rng.cpp.o"
+  "CMakeFiles/test_utilities.dir/test_rng.cpp.o.d"
+  "CMakeFiles/test_utilities.dir/test_timer.cpp.o"
+  "CMakeFiles/test_utilities.dir/test_timer.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_utilities.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,76 @@
+# Install script for directory: /root/repo/src
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "RELEASE")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(NOT CMAKE_INSTALL_LOCAL_ONLY)
+  # Include the install script for each subdirectory.
+  include("/root/repo/_complex_build/src/einspline/cmake_install.cmake")
+  include("/root/repo/_complex_build/src/Containers/cmake_install.cmake")
+  include("/root/repo/_complex_build/src/Message/cmake_install.cmake")
+  include("/root/repo/_complex_build/src/Platforms/cmake_install.cmake")
+  include("/root/repo/_complex_build/src/Particle/cmake_install.cmake")
+  include("/root/repo/_complex_build/src/QMCWaveFunctions/cmake_install.cmake")
+  include("/root/repo/_complex_build/src/QMCHamiltonians/cmake_install.cmake")
+  include("/root/repo/_complex_build/src/QMCDrivers/cmake_install.cmake")
+  include("/root/repo/_complex_build/src/formic/utils/cmake_install.cmake")
+  include("/root/repo/_complex_build/src/QMCApp/cmake_install.cmake")
+  include("/root/repo/_complex_build/src/QMCTools/cmake_install.cmake")
+  include("/root/repo/_complex_build/src/Numerics/tests/cmake_install.cmake")
+  include("/root/repo/_complex_build/src/Utilities/tests/cmake_install.cmake")
+  include("/root/repo/_complex_build/src/einspline/tests/cmake_install.cmake")
+  include("/root/repo/_complex_build/src/spline2/tests/cmake_install.cmake")
+  include("/root/repo/_complex_build/src/Concurrency/tests/cmake_install.cmake")
+  include("/root/repo/_complex_build/src/OhmmsData/tests/cmake_install.cmake")
+  include("/root/repo/_complex_build/src/io/tests/cmake_install.cmake")
+  include("/root/repo/_complex_build/src/QMCWaveFunctions/tests/cmake_install.cmake")
+  include("/root/repo/_complex_build/src/QMCHamiltonians/tests/cmake_install.cmake")
+  include("/root/repo/_complex_build/src/type_traits/tests/cmake_install.cmake")
+  include("/root/repo/_complex_build/src/Estimators/tests/cmake_install.cmake")
+  include("/root/repo/_complex_build/src/QMCDrivers/tests/cmake_install.cmake")
+  include("/root/repo/_complex_build/src/QMCApp/tests/cmake_install.cmake")
+  include("/root/repo/_complex_build/src/Message/tests/cmake_install.cmake")
+  include("/root/repo/_complex_build/src/Optimize/tests/cmake_install.cmake")
+  include("/root/repo/_complex_build/src/QMCTools/tests/cmake_install.cmake")
+
+endif()
+
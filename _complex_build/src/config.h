@@ -0,0 +1,177 @@
+/* src/ohmms-config.h.in.  Generated from configure.in by autoheader.  */
+// -*- c++  -*-
+//
+//Ohmms Configuration Header. Automatically Generated
+//
+//See the LICENSE file in the top-level directory for copyright notices
+//
+#ifndef QMCPLUSPLUS_CONFIGURATION_H
+#define QMCPLUSPLUS_CONFIGURATION_H
+
+/* define the major version */
+#define QMCPACK_VERSION_MAJOR  3
+
+/* define the minor version */
+#define QMCPACK_VERSION_MINOR  9
+
+/* define the patch version */
+#define QMCPACK_VERSION_PATCH  9
+
+/* define the release version */
+/* #undef QMCPACK_RELEASE */
+
+/* define the git last commit date */
+/* #undef QMCPLUSPLUS_LAST_CHANGED_DATE */
+
+/* building from Git repository or not */
+#define IS_GIT_PROJECT  1
+
+/* define QMC_BUILD_SANDBOX_ONLY */
+/* #undef QMC_BUILD_SANDBOX_ONLY */
+
+/* define PRINT_DEBUG */
+/* #undef PRINT_DEBUG */
+
+/* Enable OpenMP parallelization. */
+#define ENABLE_OPENMP 1
+
+/* Enable OpenMP offload. */
+/* #undef ENABLE_OFFLOAD */
+
+#ifdef ENABLE_OFFLOAD
+  #define PRAGMA_OFFLOAD(x) _Pragma(x)
+#else
+  #define PRAGMA_OFFLOAD(x)
+#endif
+
+/* Define to 1 if you have the `blitz' library */
+/* #undef HAVE_LIBBLITZ */
+
+/* Define to 1 if you have libxml++ */
+/* #undef HAVE_LIBXMLPP */
+
+/* Define to 1 if you have gsl */
+/* #undef HAVE_LIBGSL */
+
+/* Define to 1 if you have MPI library */
+/* #undef HAVE_MPI */
+
+/* Define the physical dimension of appliation. */
+#define OHMMS_DIM 3
+
+/* Define the index type: int, long */
+#define OHMMS_INDEXTYPE int
+
+/* Define the base precision: float, double */
+#define OHMMS_PRECISION double
+
+/* Define the full precision: double, long double */
+#define OHMMS_PRECISION_FULL double
+
+/* Define to 1 if precision is mixed, only for the CPU code */
+/* #undef MIXED_PRECISION */
+
+/* Define to 1 if complex wavefunctions are used */
+#define QMC_COMPLEX 1
+
+/* Define if sincos function exists */
+#define HAVE_SINCOS 1
+
+/* Define if external einspline is found */
+/* #undef HAVE_EINSPLINE_EXT */
+
+#ifndef HAVE_EINSPLINE_EXT
+
+/* Define if posix_memalign function exists */
+#define HAVE_POSIX_MEMALIGN 1
+
+/* Define if dlfcn.h exists */
+#define HAVE_DLFCN_H 1
+
+/* Define if inttypes.h exists */
+#define HAVE_INTTYPES_H 1
+
+/* Define if memory.h exists */
+#define HAVE_MEMORY_H 1
+
+/* Define if pmmintrin.h exists */
+/* #undef HAVE_PMMINTRIN_H */
+
+/* Define if emmintrin.h exists */
+/* #undef HAVE_EMMINTRIN_H */
+
+/* Define if sys/stat.h exists */
+#define HAVE_SYS_STAT_H 1
+
+/* Define if sys/time.h exists */
+#define HAVE_SYS_TIME_H 1
+
+/* Define if sys/types.h exists */
+#define HAVE_SYS_TYPES_H 1
+
+/* Define if unistd.h exists */
+#define HAVE_UNISTD_H 1
+
+#endif /* HAVE_EINSPLINE_EXT */
+
+/* Find ESSL library */
+/* #undef HAVE_ESSL */
+
+/* Find acml library */
+/* #undef HAVE_ACML */
+
+/* Using CUDA for GPU execution */
+/* #undef QMC_CUDA */
+
+/* Using CUDA for GPU execution, next generation */
+/* #undef ENABLE_CUDA */
+
+/* Using boost::stacktrace */ 
+/* #undef ENABLE_STACKTRACE */
+
+/* Setting base precision for CUDA kernels */
+/* #undef CUDA_PRECISION */
+
+/* Setting full precision for CUDA kernels */
+/* #undef CUDA_PRECISION_FULL */
+
+/* For AFQMC compilation  */
+/* #undef BUILD_AFQMC */
+
+/* For AFQMC compilation  */
+/* #undef BUILD_AFQMC_WITH_NCCL */
+
+/* For FCIQMC compilation  */
+/* #undef BUILD_FCIQMC */
+
+/* #undef DEBUG_PSIBUFFER_ON */
+
+/* Disable trace manager and associated features */
+/* #undef DISABLE_TRACEMANAGER */
+
+/* Fully remove trace manager and associated features */
+/* #undef REMOVE_TRACEMANAGER */
+
+/* Use SOA version of AA distance table */
+#define ENABLE_SOA 1
+
+/* Fixed Size Walker Properties */
+#define WALKER_MAX_PROPERTIES 2048
+
+/* Internal timers */
+/* #undef ENABLE_TIMERS */
+
+/* Use VTune API */
+/* #undef USE_VTUNE_API */
+
+/* Use VTune Task API with timers */
+/* #undef USE_VTUNE_TASKS */
+
+/* Record hardware performance counters with timers */
+/* #undef USE_PERF_COUNTERS */
+
+/* Enable NVTX regions in CUDA code. */
+/* #undef USE_NVTX_API */
+
+#endif // QMCPLUSPLUS_CONFIGURATION_H
+
@@ -0,0 +1,32 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/einspline/bspline_create.c" "src/einspline/CMakeFiles/einspline.dir/bspline_create.c.o" "gcc" "src/einspline/CMakeFiles/einspline.dir/bspline_create.c.o.d"
+  "/root/repo/src/einspline/bspline_data.c" "src/einspline/CMakeFiles/einspline.dir/bspline_data.c.o" "gcc" "src/einspline/CMakeFiles/einspline.dir/bspline_data.c.o.d"
+  "/root/repo/src/einspline/multi_bspline_copy.c" "src/einspline/CMakeFiles/einspline.dir/multi_bspline_copy.c.o" "gcc" "src/einspline/CMakeFiles/einspline.dir/multi_bspline_copy.c.o.d"
+  "/root/repo/src/einspline/multi_bspline_create.c" "src/einspline/CMakeFiles/einspline.dir/multi_bspline_create.c.o" "gcc" "src/einspline/CMakeFiles/einspline.dir/multi_bspline_create.c.o.d"
+  "/root/repo/src/einspline/multi_nubspline_create.c" "src/einspline/CMakeFiles/einspline.dir/multi_nubspline_create.c.o" "gcc" "src/einspline/CMakeFiles/einspline.dir/multi_nubspline_create.c.o.d"
+  "/root/repo/src/einspline/nubasis.c" "src/einspline/CMakeFiles/einspline.dir/nubasis.c.o" "gcc" "src/einspline/CMakeFiles/einspline.dir/nubasis.c.o.d"
+  "/root/repo/src/einspline/nubspline_create.c" "src/einspline/CMakeFiles/einspline.dir/nubspline_create.c.o" "gcc" "src/einspline/CMakeFiles/einspline.dir/nubspline_create.c.o.d"
+  "/root/repo/src/einspline/nugrid.c" "src/einspline/CMakeFiles/einspline.dir/nugrid.c.o" "gcc" "src/einspline/CMakeFiles/einspline.dir/nugrid.c.o.d"
+  "/root/repo/src/einspline/bspline_eval_d_std.cpp" "src/einspline/CMakeFiles/einspline.dir/bspline_eval_d_std.cpp.o" "gcc" "src/einspline/CMakeFiles/einspline.dir/bspline_eval_d_std.cpp.o.d"
+  "/root/repo/src/einspline/multi_bspline_eval_d_std3.cpp" "src/einspline/CMakeFiles/einspline.dir/multi_bspline_eval_d_std3.cpp.o" "gcc" "src/einspline/CMakeFiles/einspline.dir/multi_bspline_eval_d_std3.cpp.o.d"
+  "/root/repo/src/einspline/multi_bspline_eval_s_std3.cpp" "src/einspline/CMakeFiles/einspline.dir/multi_bspline_eval_s_std3.cpp.o" "gcc" "src/einspline/CMakeFiles/einspline.dir/multi_bspline_eval_s_std3.cpp.o.d"
+  "/root/repo/src/einspline/multi_bspline_eval_z_std3.cpp" "src/einspline/CMakeFiles/einspline.dir/multi_bspline_eval_z_std3.cpp.o" "gcc" "src/einspline/CMakeFiles/einspline.dir/multi_bspline_eval_z_std3.cpp.o.d"
+  "/root/repo/src/einspline/multi_nubspline_eval_z_std.cpp" "src/einspline/CMakeFiles/einspline.dir/multi_nubspline_eval_z_std.cpp.o" "gcc" "src/einspline/CMakeFiles/einspline.dir/multi_nubspline_eval_z_std.cpp.o.d"
+  "/root/repo/src/einspline/nubspline_eval_d_std.cpp" "src/einspline/CMakeFiles/einspline.dir/nubspline_eval_d_std.cpp.o" "gcc" "src/einspline/CMakeFiles/einspline.dir/nubspline_eval_d_std.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
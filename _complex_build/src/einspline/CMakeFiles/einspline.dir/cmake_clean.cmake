@@ -0,0 +1,37 @@
+file(REMOVE_RECURSE
+  "../../lib/libeinspline.a"
+  "../../lib/libeinspline.pdb"
+  "CMakeFiles/einspline.dir/bspline_create.c.o"
+  "CMakeFiles/einspline.dir/bspline_create.c.o.d"
+  "CMakeFiles/einspline.dir/bspline_data.c.o"
+  "CMakeFiles/einspline.dir/bspline_data.c.o.d"
+  "CMakeFiles/einspline.dir/bspline_eval_d_std.cpp.o"
+  "CMakeFiles/einspline.dir/bspline_eval_d_std.cpp.o.d"
+  "CMakeFiles/einspline.dir/multi_bspline_copy.c.o"
+  "CMakeFiles/einspline.dir/multi_bspline_copy.c.o.d"
+  "CMakeFiles/einspline.dir/multi_bspline_create.c.o"
+  "CMakeFiles/einspline.dir/multi_bspline_create.c.o.d"
+  "CMakeFiles/einspline.dir/multi_bspline_eval_d_std3.cpp.o"
+  "CMakeFiles/einspline.dir/multi_bspline_eval_d_std3.cpp.o.d"
+  "CMakeFiles/einspline.dir/multi_bspline_eval_s_std3.cpp.o"
+  "CMakeFiles/einspline.dir/multi_bspline_eval_s_std3.cpp.o.d"
+  "CMakeFiles/einspline.dir/multi_bspline_eval_z_std3.cpp.o"
+  "CMakeFiles/einspline.dir/multi_bspline_eval_z_std3.cpp.o.d"
+  "CMakeFiles/einspline.dir/multi_nubspline_create.c.o"
+  "CMakeFiles/einspline.dir/multi_nubspline_create.c.o.d"
+  "CMakeFiles/einspline.dir/multi_nubspline_eval_z_std.cpp.o"
+  "CMakeFiles/einspline.dir/multi_nubspline_eval_z_std.cpp.o.d"
+  "CMakeFiles/einspline.dir/nubasis.c.o"
+  "CMakeFiles/einspline.dir/nubasis.c.o.d"
+  "CMakeFiles/einspline.dir/nubspline_create.c.o"
+  "CMakeFiles/einspline.dir/nubspline_create.c.o.d"
+  "CMakeFiles/einspline.dir/nubspline_eval_d_std.cpp.o"
+  "CMakeFiles/einspline.dir/nubspline_eval_d_std.cpp.o.d"
+  "CMakeFiles/einspline.dir/nugrid.c.o"
+  "CMakeFiles/einspline.dir/nugrid.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/einspline.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
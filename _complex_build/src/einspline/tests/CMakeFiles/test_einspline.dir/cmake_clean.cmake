@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../tests/bin/test_einspline"
+  "../../../tests/bin/test_einspline.pdb"
+  "CMakeFiles/test_einspline.dir/test_3d.cpp.o"
+  "CMakeFiles/test_einspline.dir/test_3d.cpp.o.d"
+  "CMakeFiles/test_einspline.dir/test_one.cpp.o"
+  "CMakeFiles/test_einspline.dir/test_one.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_einspline.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,36 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/formic/utils/lapack_interface.cpp" "src/formic/utils/CMakeFiles/formic_utils.dir/lapack_interface.cpp.o" "gcc" "src/formic/utils/CMakeFiles/formic_utils.dir/lapack_interface.cpp.o.d"
+  "/root/repo/src/formic/utils/lmyengine/block_alg.cpp" "src/formic/utils/CMakeFiles/formic_utils.dir/lmyengine/block_alg.cpp.o" "gcc" "src/formic/utils/CMakeFiles/formic_utils.dir/lmyengine/block_alg.cpp.o.d"
+  "/root/repo/src/formic/utils/lmyengine/block_detail.cpp" "src/formic/utils/CMakeFiles/formic_utils.dir/lmyengine/block_detail.cpp.o" "gcc" "src/formic/utils/CMakeFiles/formic_utils.dir/lmyengine/block_detail.cpp.o.d"
+  "/root/repo/src/formic/utils/lmyengine/block_mat.cpp" "src/formic/utils/CMakeFiles/formic_utils.dir/lmyengine/block_mat.cpp.o" "gcc" "src/formic/utils/CMakeFiles/formic_utils.dir/lmyengine/block_mat.cpp.o.d"
+  "/root/repo/src/formic/utils/lmyengine/energy_target.cpp" "src/formic/utils/CMakeFiles/formic_utils.dir/lmyengine/energy_target.cpp.o" "gcc" "src/formic/utils/CMakeFiles/formic_utils.dir/lmyengine/energy_target.cpp.o.d"
+  "/root/repo/src/formic/utils/lmyengine/engine.cpp" "src/formic/utils/CMakeFiles/formic_utils.dir/lmyengine/engine.cpp.o" "gcc" "src/formic/utils/CMakeFiles/formic_utils.dir/lmyengine/engine.cpp.o.d"
+  "/root/repo/src/formic/utils/lmyengine/engine_numeric.cpp" "src/formic/utils/CMakeFiles/formic_utils.dir/lmyengine/engine_numeric.cpp.o" "gcc" "src/formic/utils/CMakeFiles/formic_utils.dir/lmyengine/engine_numeric.cpp.o.d"
+  "/root/repo/src/formic/utils/lmyengine/engine_timing.cpp" "src/formic/utils/CMakeFiles/formic_utils.dir/lmyengine/engine_timing.cpp.o" "gcc" "src/formic/utils/CMakeFiles/formic_utils.dir/lmyengine/engine_timing.cpp.o.d"
+  "/root/repo/src/formic/utils/lmyengine/spam_solver.cpp" "src/formic/utils/CMakeFiles/formic_utils.dir/lmyengine/spam_solver.cpp.o" "gcc" "src/formic/utils/CMakeFiles/formic_utils.dir/lmyengine/spam_solver.cpp.o.d"
+  "/root/repo/src/formic/utils/lmyengine/var_dependencies.cpp" "src/formic/utils/CMakeFiles/formic_utils.dir/lmyengine/var_dependencies.cpp.o" "gcc" "src/formic/utils/CMakeFiles/formic_utils.dir/lmyengine/var_dependencies.cpp.o.d"
+  "/root/repo/src/formic/utils/matrix.cpp" "src/formic/utils/CMakeFiles/formic_utils.dir/matrix.cpp.o" "gcc" "src/formic/utils/CMakeFiles/formic_utils.dir/matrix.cpp.o.d"
+  "/root/repo/_complex_build/src/formic/utils/mpi_interface.cpp" "src/formic/utils/CMakeFiles/formic_utils.dir/mpi_interface.cpp.o" "gcc" "src/formic/utils/CMakeFiles/formic_utils.dir/mpi_interface.cpp.o.d"
+  "/root/repo/src/formic/utils/numeric.cpp" "src/formic/utils/CMakeFiles/formic_utils.dir/numeric.cpp.o" "gcc" "src/formic/utils/CMakeFiles/formic_utils.dir/numeric.cpp.o.d"
+  "/root/repo/src/formic/utils/numeric_matrix.cpp" "src/formic/utils/CMakeFiles/formic_utils.dir/numeric_matrix.cpp.o" "gcc" "src/formic/utils/CMakeFiles/formic_utils.dir/numeric_matrix.cpp.o.d"
+  "/root/repo/src/formic/utils/porabola_min_max.cpp" "src/formic/utils/CMakeFiles/formic_utils.dir/porabola_min_max.cpp.o" "gcc" "src/formic/utils/CMakeFiles/formic_utils.dir/porabola_min_max.cpp.o.d"
+  "/root/repo/src/formic/utils/random.cpp" "src/formic/utils/CMakeFiles/formic_utils.dir/random.cpp.o" "gcc" "src/formic/utils/CMakeFiles/formic_utils.dir/random.cpp.o.d"
+  "/root/repo/src/formic/utils/reusable_array.cpp" "src/formic/utils/CMakeFiles/formic_utils.dir/reusable_array.cpp.o" "gcc" "src/formic/utils/CMakeFiles/formic_utils.dir/reusable_array.cpp.o.d"
+  "/root/repo/src/formic/utils/timing.cpp" "src/formic/utils/CMakeFiles/formic_utils.dir/timing.cpp.o" "gcc" "src/formic/utils/CMakeFiles/formic_utils.dir/timing.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,45 @@
+file(REMOVE_RECURSE
+  "../../../lib/libformic_utils.a"
+  "../../../lib/libformic_utils.pdb"
+  "CMakeFiles/formic_utils.dir/lapack_interface.cpp.o"
+  "CMakeFiles/formic_utils.dir/lapack_interface.cpp.o.d"
+  "CMakeFiles/formic_utils.dir/lmyengine/block_alg.cpp.o"
+  "CMakeFiles/formic_utils.dir/lmyengine/block_alg.cpp.o.d"
+  "CMakeFiles/formic_utils.dir/lmyengine/block_detail.cpp.o"
+  "CMakeFiles/formic_utils.dir/lmyengine/block_detail.cpp.o.d"
+  "CMakeFiles/formic_utils.dir/lmyengine/block_mat.cpp.o"
+  "CMakeFiles/formic_utils.dir/lmyengine/block_mat.cpp.o.d"
+  "CMakeFiles/formic_utils.dir/lmyengine/energy_target.cpp.o"
+  "CMakeFiles/formic_utils.dir/lmyengine/energy_target.cpp.o.d"
+  "CMakeFiles/formic_utils.dir/lmyengine/engine.cpp.o"
+  "CMakeFiles/formic_utils.dir/lmyengine/engine.cpp.o.d"
+  "CMakeFiles/formic_utils.dir/lmyengine/engine_numeric.cpp.o"
+  "CMakeFiles/formic_utils.dir/lmyengine/engine_numeric.cpp.o.d"
+  "CMakeFiles/formic_utils.dir/lmyengine/engine_timing.cpp.o"
+  "CMakeFiles/formic_utils.dir/lmyengine/engine_timing.cpp.o.d"
+  "CMakeFiles/formic_utils.dir/lmyengine/spam_solver.cpp.o"
+  "CMakeFiles/formic_utils.dir/lmyengine/spam_solver.cpp.o.d"
+  "CMakeFiles/formic_utils.dir/lmyengine/var_dependencies.cpp.o"
+  "CMakeFiles/formic_utils.dir/lmyengine/var_dependencies.cpp.o.d"
+  "CMakeFiles/formic_utils.dir/matrix.cpp.o"
+  "CMakeFiles/formic_utils.dir/matrix.cpp.o.d"
+  "CMakeFiles/formic_utils.dir/mpi_interface.cpp.o"
+  "CMakeFiles/formic_utils.dir/mpi_interface.cpp.o.d"
+  "CMakeFiles/formic_utils.dir/numeric.cpp.o"
+  "CMakeFiles/formic_utils.dir/numeric.cpp.o.d"
+  "CMakeFiles/formic_utils.dir/numeric_matrix.cpp.o"
+  "CMakeFiles/formic_utils.dir/numeric_matrix.cpp.o.d"
+  "CMakeFiles/formic_utils.dir/porabola_min_max.cpp.o"
+  "CMakeFiles/formic_utils.dir/porabola_min_max.cpp.o.d"
+  "CMakeFiles/formic_utils.dir/random.cpp.o"
+  "CMakeFiles/formic_utils.dir/random.cpp.o.d"
+  "CMakeFiles/formic_utils.dir/reusable_array.cpp.o"
+  "CMakeFiles/formic_utils.dir/reusable_array.cpp.o.d"
+  "CMakeFiles/formic_utils.dir/timing.cpp.o"
+  "CMakeFiles/formic_utils.dir/timing.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/formic_utils.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,6 @@
+#ifndef FORMIC_LAPACK_DECLARE_HEADER
+#define FORMIC_LAPACK_DECLARE_HEADER
+
+#include<formic/utils/declare_other.h>
+
+#endif
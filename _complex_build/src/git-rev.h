@@ -0,0 +1,7 @@
+#define GIT_BRANCH_RAW master
+
+#define GIT_HASH_RAW 9ee891f8281da7e5a9874031cbbad7379840ba4e-dirty
+
+#define GIT_COMMIT_LAST_CHANGED_RAW Mon Oct 19 10:50:19 2026 +0000
+
+#define GIT_COMMIT_SUBJECT_RAW "[user-034] fix: make the perf counter reduction collective in collate_flat_profile"
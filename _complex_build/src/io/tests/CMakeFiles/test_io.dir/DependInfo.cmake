@@ -0,0 +1,30 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/io/tests/test_hdf_archive.cpp" "src/io/tests/CMakeFiles/test_io.dir/test_hdf_archive.cpp.o" "gcc" "src/io/tests/CMakeFiles/test_io.dir/test_hdf_archive.cpp.o.d"
+  "/root/repo/src/io/tests/test_hdf_hyperslab.cpp" "src/io/tests/CMakeFiles/test_io.dir/test_hdf_hyperslab.cpp.o" "gcc" "src/io/tests/CMakeFiles/test_io.dir/test_hdf_hyperslab.cpp.o.d"
+  "/root/repo/src/io/tests/test_hdf_parallel.cpp" "src/io/tests/CMakeFiles/test_io.dir/test_hdf_parallel.cpp.o" "gcc" "src/io/tests/CMakeFiles/test_io.dir/test_hdf_parallel.cpp.o.d"
+  "/root/repo/src/io/tests/test_hdf_reshape.cpp" "src/io/tests/CMakeFiles/test_io.dir/test_hdf_reshape.cpp.o" "gcc" "src/io/tests/CMakeFiles/test_io.dir/test_hdf_reshape.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_complex_build/src/Message/CMakeFiles/catch_main.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/CMakeFiles/qmcutil.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Containers/CMakeFiles/containers.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/CMakeFiles/platform_device.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Message/CMakeFiles/message.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/CMakeFiles/platform_host.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/CPU/CMakeFiles/platform_cpu.dir/DependInfo.cmake"
+  "/root/repo/_complex_build/src/Platforms/OpenMP/CMakeFiles/platform_omp.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "../../../tests/bin/test_io"
+  "../../../tests/bin/test_io.pdb"
+  "CMakeFiles/test_io.dir/test_hdf_archive.cpp.o"
+  "CMakeFiles/test_io.dir/test_hdf_archive.cpp.o.d"
+  "CMakeFiles/test_io.dir/test_hdf_hyperslab.cpp.o"
+  "CMakeFiles/test_io.dir/test_hdf_hyperslab.cpp.o.d"
+  "CMakeFiles/test_io.dir/test_hdf_parallel.cpp.o"
+  "CMakeFiles/test_io.dir/test_hdf_parallel.cpp.o.d"
+  "CMakeFiles/test_io.dir/test_hdf_reshape.cpp.o"
+  "CMakeFiles/test_io.dir/test_hdf_reshape.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_io.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/io/tests
+# Build directory: /root/repo/_complex_build/src/io/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(deterministic-unit_test_io "/root/repo/_complex_build/tests/bin/test_io")
+set_tests_properties(deterministic-unit_test_io PROPERTIES  LABELS "quality_unknown;deterministic;unit" WORKING_DIRECTORY "/root/repo/_complex_build/tests/io/tmp" _BACKTRACE_TRIPLES "/root/repo/CMake/unit_test.cmake;11;ADD_TEST;/root/repo/src/io/tests/CMakeLists.txt;31;ADD_UNIT_TEST;/root/repo/src/io/tests/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../tests/bin/test_spline2"
+  "../../../tests/bin/test_spline2.pdb"
+  "CMakeFiles/test_spline2.dir/test_multi_spline.cpp.o"
+  "CMakeFiles/test_spline2.dir/test_multi_spline.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_spline2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../tests/bin/test_type_traits"
+  "../../../tests/bin/test_type_traits.pdb"
+  "CMakeFiles/test_type_traits.dir/test_qmctypes.cpp.o"
+  "CMakeFiles/test_type_traits.dir/test_qmctypes.cpp.o.d"
+  "CMakeFiles/test_type_traits.dir/test_template_types.cpp.o"
+  "CMakeFiles/test_type_traits.dir/test_template_types.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_type_traits.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests
+# Build directory: /root/repo/_complex_build/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("converter")
+subdirs("estimator")
+subdirs("models")
+subdirs("io")
+subdirs("performance")
+subdirs("heg/heg_14_gamma")
+subdirs("heg/heg_54_J2rpa")
+subdirs("molecules")
+subdirs("solids")
@@ -0,0 +1,28 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/converter
+# Build directory: /root/repo/_complex_build/tests/converter
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(converter_test_He_sto3g "python" "converter_test.py" "/root/repo/_complex_build/tests/converter/test_He_sto3g" "--exe" "/root/repo/_complex_build/bin/convert4qmc" "--h5diff" "HDF5_DIFF_EXECUTABLE-NOTFOUND")
+set_tests_properties(converter_test_He_sto3g PROPERTIES  LABELS "converter" TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/tests/converter/CMakeLists.txt;14;ADD_TEST;/root/repo/tests/converter/CMakeLists.txt;26;ADD_CONVERTER_TEST;/root/repo/tests/converter/CMakeLists.txt;0;")
+add_test(converter_test_Be_sto3g "python" "converter_test.py" "/root/repo/_complex_build/tests/converter/test_Be_sto3g" "--exe" "/root/repo/_complex_build/bin/convert4qmc" "--h5diff" "HDF5_DIFF_EXECUTABLE-NOTFOUND")
+set_tests_properties(converter_test_Be_sto3g PROPERTIES  LABELS "converter" TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/tests/converter/CMakeLists.txt;14;ADD_TEST;/root/repo/tests/converter/CMakeLists.txt;27;ADD_CONVERTER_TEST;/root/repo/tests/converter/CMakeLists.txt;0;")
+add_test(converter_test_Be_ccd "python" "converter_test.py" "/root/repo/_complex_build/tests/converter/test_Be_ccd" "--exe" "/root/repo/_complex_build/bin/convert4qmc" "--h5diff" "HDF5_DIFF_EXECUTABLE-NOTFOUND")
+set_tests_properties(converter_test_Be_ccd PROPERTIES  LABELS "converter" TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/tests/converter/CMakeLists.txt;14;ADD_TEST;/root/repo/tests/converter/CMakeLists.txt;28;ADD_CONVERTER_TEST;/root/repo/tests/converter/CMakeLists.txt;0;")
+add_test(converter_test_O_ext "python" "converter_test.py" "/root/repo/_complex_build/tests/converter/test_O_ext" "--exe" "/root/repo/_complex_build/bin/convert4qmc" "--h5diff" "HDF5_DIFF_EXECUTABLE-NOTFOUND")
+set_tests_properties(converter_test_O_ext PROPERTIES  LABELS "converter" TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/tests/converter/CMakeLists.txt;14;ADD_TEST;/root/repo/tests/converter/CMakeLists.txt;29;ADD_CONVERTER_TEST;/root/repo/tests/converter/CMakeLists.txt;0;")
+add_test(converter_test_C_sto3g "python" "converter_test.py" "/root/repo/_complex_build/tests/converter/test_C_sto3g" "--exe" "/root/repo/_complex_build/bin/convert4qmc" "--h5diff" "HDF5_DIFF_EXECUTABLE-NOTFOUND")
+set_tests_properties(converter_test_C_sto3g PROPERTIES  LABELS "converter" TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/tests/converter/CMakeLists.txt;14;ADD_TEST;/root/repo/tests/converter/CMakeLists.txt;30;ADD_CONVERTER_TEST;/root/repo/tests/converter/CMakeLists.txt;0;")
+add_test(converter_test_HCNp "python" "converter_test.py" "/root/repo/_complex_build/tests/converter/test_HCNp" "--exe" "/root/repo/_complex_build/bin/convert4qmc" "--h5diff" "HDF5_DIFF_EXECUTABLE-NOTFOUND")
+set_tests_properties(converter_test_HCNp PROPERTIES  LABELS "converter" TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/tests/converter/CMakeLists.txt;14;ADD_TEST;/root/repo/tests/converter/CMakeLists.txt;31;ADD_CONVERTER_TEST;/root/repo/tests/converter/CMakeLists.txt;0;")
+add_test(converter_test_aldet1 "python" "converter_test.py" "/root/repo/_complex_build/tests/converter/test_aldet1" "--exe" "/root/repo/_complex_build/bin/convert4qmc" "--h5diff" "HDF5_DIFF_EXECUTABLE-NOTFOUND")
+set_tests_properties(converter_test_aldet1 PROPERTIES  LABELS "converter" TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/tests/converter/CMakeLists.txt;14;ADD_TEST;/root/repo/tests/converter/CMakeLists.txt;32;ADD_CONVERTER_TEST;/root/repo/tests/converter/CMakeLists.txt;0;")
+add_test(converter_test_aldet5 "python" "converter_test.py" "/root/repo/_complex_build/tests/converter/test_aldet5" "--exe" "/root/repo/_complex_build/bin/convert4qmc" "--h5diff" "HDF5_DIFF_EXECUTABLE-NOTFOUND")
+set_tests_properties(converter_test_aldet5 PROPERTIES  LABELS "converter" TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/tests/converter/CMakeLists.txt;14;ADD_TEST;/root/repo/tests/converter/CMakeLists.txt;33;ADD_CONVERTER_TEST;/root/repo/tests/converter/CMakeLists.txt;0;")
+add_test(converter_test_aldet6 "python" "converter_test.py" "/root/repo/_complex_build/tests/converter/test_aldet6" "--exe" "/root/repo/_complex_build/bin/convert4qmc" "--h5diff" "HDF5_DIFF_EXECUTABLE-NOTFOUND")
+set_tests_properties(converter_test_aldet6 PROPERTIES  LABELS "converter" TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/tests/converter/CMakeLists.txt;14;ADD_TEST;/root/repo/tests/converter/CMakeLists.txt;34;ADD_CONVERTER_TEST;/root/repo/tests/converter/CMakeLists.txt;0;")
+add_test(converter_test_LiH_pyscf "python" "converter_test.py" "/root/repo/_complex_build/tests/converter/test_LiH_pyscf" "--exe" "/root/repo/_complex_build/bin/convert4qmc" "--h5diff" "HDF5_DIFF_EXECUTABLE-NOTFOUND")
+set_tests_properties(converter_test_LiH_pyscf PROPERTIES  LABELS "converter" TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/tests/converter/CMakeLists.txt;14;ADD_TEST;/root/repo/tests/converter/CMakeLists.txt;47;ADD_CONVERTER_TEST;/root/repo/tests/converter/CMakeLists.txt;0;")
+add_test(converter_test_LiH_qp "python" "converter_test.py" "/root/repo/_complex_build/tests/converter/test_LiH_qp" "--exe" "/root/repo/_complex_build/bin/convert4qmc" "--h5diff" "HDF5_DIFF_EXECUTABLE-NOTFOUND")
+set_tests_properties(converter_test_LiH_qp PROPERTIES  LABELS "converter" TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/tests/converter/CMakeLists.txt;14;ADD_TEST;/root/repo/tests/converter/CMakeLists.txt;48;ADD_CONVERTER_TEST;/root/repo/tests/converter/CMakeLists.txt;0;")
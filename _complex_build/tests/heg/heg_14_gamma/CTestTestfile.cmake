@@ -0,0 +1,78 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/heg/heg_14_gamma
+# Build directory: /root/repo/_complex_build/tests/heg/heg_14_gamma
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(short-heg_14_gamma-ni-1-16 "/root/repo/_complex_build/bin/qmcpack" "heg-short-NI.xml")
+set_tests_properties(short-heg_14_gamma-ni-1-16 PROPERTIES  ENVIRONMENT "OMP_NUM_THREADS=16" FAIL_REGULAR_EXPRESSION "" LABELS "quality_unknown;QMCPACK" PROCESSORS "16" PROCESSOR_AFFINITY "TRUE" WORKING_DIRECTORY "/root/repo/_complex_build/tests/heg/heg_14_gamma/short-heg_14_gamma-ni-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;101;ADD_TEST;/root/repo/CMake/macros.cmake;124;RUN_QMC_APP_NO_COPY;/root/repo/CMake/macros.cmake;167;RUN_QMC_APP;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;23;QMC_RUN_AND_CHECK;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;0;")
+add_test(short-heg_14_gamma-ni-1-16-totenergy "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "heg_short_NI" "-e" "2" "--le" " 0.627711  0.000001")
+set_tests_properties(short-heg_14_gamma-ni-1-16-totenergy PROPERTIES  DEPENDS "short-heg_14_gamma-ni-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/heg/heg_14_gamma/short-heg_14_gamma-ni-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;23;QMC_RUN_AND_CHECK;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;0;")
+add_test(short-heg_14_gamma-ni-1-16-variance "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "heg_short_NI" "-e" "2" "--va" " 0.000000  0.000001")
+set_tests_properties(short-heg_14_gamma-ni-1-16-variance PROPERTIES  DEPENDS "short-heg_14_gamma-ni-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/heg/heg_14_gamma/short-heg_14_gamma-ni-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;23;QMC_RUN_AND_CHECK;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;0;")
+add_test(short-heg_14_gamma-ni_dmc-1-16 "/root/repo/_complex_build/bin/qmcpack" "heg-short-NI-dmc.xml")
+set_tests_properties(short-heg_14_gamma-ni_dmc-1-16 PROPERTIES  ENVIRONMENT "OMP_NUM_THREADS=16" FAIL_REGULAR_EXPRESSION "" LABELS "quality_unknown;QMCPACK" PROCESSORS "16" PROCESSOR_AFFINITY "TRUE" WORKING_DIRECTORY "/root/repo/_complex_build/tests/heg/heg_14_gamma/short-heg_14_gamma-ni_dmc-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;101;ADD_TEST;/root/repo/CMake/macros.cmake;124;RUN_QMC_APP_NO_COPY;/root/repo/CMake/macros.cmake;167;RUN_QMC_APP;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;38;QMC_RUN_AND_CHECK;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;0;")
+add_test(short-heg_14_gamma-ni_dmc-1-16-totenergy "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "1" "-p" "heg_short_NI_dmc" "-e" "2" "--le" " 0.627711  0.000001")
+set_tests_properties(short-heg_14_gamma-ni_dmc-1-16-totenergy PROPERTIES  DEPENDS "short-heg_14_gamma-ni_dmc-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/heg/heg_14_gamma/short-heg_14_gamma-ni_dmc-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;38;QMC_RUN_AND_CHECK;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;0;")
+add_test(short-heg_14_gamma-ni_dmc-1-16-variance "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "1" "-p" "heg_short_NI_dmc" "-e" "2" "--va" " 0.000000  0.000001")
+set_tests_properties(short-heg_14_gamma-ni_dmc-1-16-variance PROPERTIES  DEPENDS "short-heg_14_gamma-ni_dmc-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/heg/heg_14_gamma/short-heg_14_gamma-ni_dmc-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;38;QMC_RUN_AND_CHECK;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;0;")
+add_test(short-heg_14_gamma-hf-1-16 "/root/repo/_complex_build/bin/qmcpack" "heg-short-HF.xml")
+set_tests_properties(short-heg_14_gamma-hf-1-16 PROPERTIES  ENVIRONMENT "OMP_NUM_THREADS=16" FAIL_REGULAR_EXPRESSION "" LABELS "quality_unknown;QMCPACK" PROCESSORS "16" PROCESSOR_AFFINITY "TRUE" WORKING_DIRECTORY "/root/repo/_complex_build/tests/heg/heg_14_gamma/short-heg_14_gamma-hf-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;101;ADD_TEST;/root/repo/CMake/macros.cmake;124;RUN_QMC_APP_NO_COPY;/root/repo/CMake/macros.cmake;167;RUN_QMC_APP;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;53;QMC_RUN_AND_CHECK;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;0;")
+add_test(short-heg_14_gamma-hf-1-16-totenergy "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "heg_short_HF" "-e" "2" "--le" "-0.812484  0.000271")
+set_tests_properties(short-heg_14_gamma-hf-1-16-totenergy PROPERTIES  DEPENDS "short-heg_14_gamma-hf-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/heg/heg_14_gamma/short-heg_14_gamma-hf-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;53;QMC_RUN_AND_CHECK;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;0;")
+add_test(short-heg_14_gamma-hf-1-16-variance "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "heg_short_HF" "-e" "2" "--va" " 0.193169  0.018612")
+set_tests_properties(short-heg_14_gamma-hf-1-16-variance PROPERTIES  DEPENDS "short-heg_14_gamma-hf-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/heg/heg_14_gamma/short-heg_14_gamma-hf-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;53;QMC_RUN_AND_CHECK;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;0;")
+add_test(short-heg_14_gamma-sj-1-16 "/root/repo/_complex_build/bin/qmcpack" "heg-short-SJ.xml")
+set_tests_properties(short-heg_14_gamma-sj-1-16 PROPERTIES  ENVIRONMENT "OMP_NUM_THREADS=16" FAIL_REGULAR_EXPRESSION "" LABELS "quality_unknown;QMCPACK" PROCESSORS "16" PROCESSOR_AFFINITY "TRUE" WORKING_DIRECTORY "/root/repo/_complex_build/tests/heg/heg_14_gamma/short-heg_14_gamma-sj-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;101;ADD_TEST;/root/repo/CMake/macros.cmake;124;RUN_QMC_APP_NO_COPY;/root/repo/CMake/macros.cmake;167;RUN_QMC_APP;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;68;QMC_RUN_AND_CHECK;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;0;")
+add_test(short-heg_14_gamma-sj-1-16-totenergy "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "heg_short_SJ" "-e" "2" "--le" "-1.073323  0.000271")
+set_tests_properties(short-heg_14_gamma-sj-1-16-totenergy PROPERTIES  DEPENDS "short-heg_14_gamma-sj-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/heg/heg_14_gamma/short-heg_14_gamma-sj-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;68;QMC_RUN_AND_CHECK;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;0;")
+add_test(short-heg_14_gamma-sj-1-16-variance "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "heg_short_SJ" "-e" "2" "--va" " 0.024574  0.000181")
+set_tests_properties(short-heg_14_gamma-sj-1-16-variance PROPERTIES  DEPENDS "short-heg_14_gamma-sj-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/heg/heg_14_gamma/short-heg_14_gamma-sj-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;68;QMC_RUN_AND_CHECK;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;0;")
+add_test(short-heg_14_gamma-sj_new-1-16 "/root/repo/_complex_build/bin/qmcpack" "heg-short-SJ-new.xml")
+set_tests_properties(short-heg_14_gamma-sj_new-1-16 PROPERTIES  ENVIRONMENT "OMP_NUM_THREADS=16" FAIL_REGULAR_EXPRESSION "" LABELS "quality_unknown;QMCPACK" PROCESSORS "16" PROCESSOR_AFFINITY "TRUE" WORKING_DIRECTORY "/root/repo/_complex_build/tests/heg/heg_14_gamma/short-heg_14_gamma-sj_new-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;101;ADD_TEST;/root/repo/CMake/macros.cmake;124;RUN_QMC_APP_NO_COPY;/root/repo/CMake/macros.cmake;167;RUN_QMC_APP;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;83;QMC_RUN_AND_CHECK;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;0;")
+add_test(short-heg_14_gamma-sj_new-1-16-totenergy "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "heg_short_SJ_new" "-e" "2" "--le" "-1.073286  0.000271")
+set_tests_properties(short-heg_14_gamma-sj_new-1-16-totenergy PROPERTIES  DEPENDS "short-heg_14_gamma-sj_new-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/heg/heg_14_gamma/short-heg_14_gamma-sj_new-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;83;QMC_RUN_AND_CHECK;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;0;")
+add_test(short-heg_14_gamma-sj_new-1-16-variance "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "heg_short_SJ_new" "-e" "2" "--va" " 0.024564  0.000342")
+set_tests_properties(short-heg_14_gamma-sj_new-1-16-variance PROPERTIES  DEPENDS "short-heg_14_gamma-sj_new-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/heg/heg_14_gamma/short-heg_14_gamma-sj_new-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;83;QMC_RUN_AND_CHECK;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;0;")
+add_test(short-heg_14_gamma-sj_dmc-1-16 "/root/repo/_complex_build/bin/qmcpack" "heg-short-SJ-dmc.xml")
+set_tests_properties(short-heg_14_gamma-sj_dmc-1-16 PROPERTIES  ENVIRONMENT "OMP_NUM_THREADS=16" FAIL_REGULAR_EXPRESSION "" LABELS "quality_unknown;QMCPACK" PROCESSORS "16" PROCESSOR_AFFINITY "TRUE" WORKING_DIRECTORY "/root/repo/_complex_build/tests/heg/heg_14_gamma/short-heg_14_gamma-sj_dmc-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;101;ADD_TEST;/root/repo/CMake/macros.cmake;124;RUN_QMC_APP_NO_COPY;/root/repo/CMake/macros.cmake;167;RUN_QMC_APP;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;98;QMC_RUN_AND_CHECK;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;0;")
+add_test(short-heg_14_gamma-sj_dmc-1-16-totenergy "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "2" "-p" "heg_short_SJ_dmc" "-e" "2" "--le" "-1.110199  0.000322")
+set_tests_properties(short-heg_14_gamma-sj_dmc-1-16-totenergy PROPERTIES  DEPENDS "short-heg_14_gamma-sj_dmc-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/heg/heg_14_gamma/short-heg_14_gamma-sj_dmc-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;98;QMC_RUN_AND_CHECK;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;0;")
+add_test(short-heg_14_gamma-sj_dmc-1-16-variance "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "2" "-p" "heg_short_SJ_dmc" "-e" "2" "--va" " 0.022894  0.000060")
+set_tests_properties(short-heg_14_gamma-sj_dmc-1-16-variance PROPERTIES  DEPENDS "short-heg_14_gamma-sj_dmc-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/heg/heg_14_gamma/short-heg_14_gamma-sj_dmc-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;98;QMC_RUN_AND_CHECK;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;0;")
+add_test(long-heg_14_gamma-ni-1-16 "/root/repo/_complex_build/bin/qmcpack" "heg-long-NI.xml")
+set_tests_properties(long-heg_14_gamma-ni-1-16 PROPERTIES  ENVIRONMENT "OMP_NUM_THREADS=16" FAIL_REGULAR_EXPRESSION "" LABELS "quality_unknown;QMCPACK" PROCESSORS "16" PROCESSOR_AFFINITY "TRUE" WORKING_DIRECTORY "/root/repo/_complex_build/tests/heg/heg_14_gamma/long-heg_14_gamma-ni-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;101;ADD_TEST;/root/repo/CMake/macros.cmake;124;RUN_QMC_APP_NO_COPY;/root/repo/CMake/macros.cmake;167;RUN_QMC_APP;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;117;QMC_RUN_AND_CHECK;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;0;")
+add_test(long-heg_14_gamma-ni-1-16-totenergy "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "heg_long_NI" "-e" "2" "--le" " 0.627711  0.000001")
+set_tests_properties(long-heg_14_gamma-ni-1-16-totenergy PROPERTIES  DEPENDS "long-heg_14_gamma-ni-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/heg/heg_14_gamma/long-heg_14_gamma-ni-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;117;QMC_RUN_AND_CHECK;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;0;")
+add_test(long-heg_14_gamma-ni-1-16-variance "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "heg_long_NI" "-e" "2" "--va" " 0.000000  0.000001")
+set_tests_properties(long-heg_14_gamma-ni-1-16-variance PROPERTIES  DEPENDS "long-heg_14_gamma-ni-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/heg/heg_14_gamma/long-heg_14_gamma-ni-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;117;QMC_RUN_AND_CHECK;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;0;")
+add_test(long-heg_14_gamma-ni_dmc-1-16 "/root/repo/_complex_build/bin/qmcpack" "heg-long-NI-dmc.xml")
+set_tests_properties(long-heg_14_gamma-ni_dmc-1-16 PROPERTIES  ENVIRONMENT "OMP_NUM_THREADS=16" FAIL_REGULAR_EXPRESSION "" LABELS "quality_unknown;QMCPACK" PROCESSORS "16" PROCESSOR_AFFINITY "TRUE" WORKING_DIRECTORY "/root/repo/_complex_build/tests/heg/heg_14_gamma/long-heg_14_gamma-ni_dmc-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;101;ADD_TEST;/root/repo/CMake/macros.cmake;124;RUN_QMC_APP_NO_COPY;/root/repo/CMake/macros.cmake;167;RUN_QMC_APP;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;132;QMC_RUN_AND_CHECK;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;0;")
+add_test(long-heg_14_gamma-ni_dmc-1-16-totenergy "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "1" "-p" "heg_long_NI_dmc" "-e" "2" "--le" " 0.627711  0.000001")
+set_tests_properties(long-heg_14_gamma-ni_dmc-1-16-totenergy PROPERTIES  DEPENDS "long-heg_14_gamma-ni_dmc-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/heg/heg_14_gamma/long-heg_14_gamma-ni_dmc-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;132;QMC_RUN_AND_CHECK;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;0;")
+add_test(long-heg_14_gamma-ni_dmc-1-16-variance "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "1" "-p" "heg_long_NI_dmc" "-e" "2" "--va" " 0.000000  0.000001")
+set_tests_properties(long-heg_14_gamma-ni_dmc-1-16-variance PROPERTIES  DEPENDS "long-heg_14_gamma-ni_dmc-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/heg/heg_14_gamma/long-heg_14_gamma-ni_dmc-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;132;QMC_RUN_AND_CHECK;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;0;")
+add_test(long-heg_14_gamma-hf-1-16 "/root/repo/_complex_build/bin/qmcpack" "heg-long-HF.xml")
+set_tests_properties(long-heg_14_gamma-hf-1-16 PROPERTIES  ENVIRONMENT "OMP_NUM_THREADS=16" FAIL_REGULAR_EXPRESSION "" LABELS "quality_unknown;QMCPACK" PROCESSORS "16" PROCESSOR_AFFINITY "TRUE" WORKING_DIRECTORY "/root/repo/_complex_build/tests/heg/heg_14_gamma/long-heg_14_gamma-hf-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;101;ADD_TEST;/root/repo/CMake/macros.cmake;124;RUN_QMC_APP_NO_COPY;/root/repo/CMake/macros.cmake;167;RUN_QMC_APP;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;147;QMC_RUN_AND_CHECK;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;0;")
+add_test(long-heg_14_gamma-hf-1-16-totenergy "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "heg_long_HF" "-e" "2" "--le" "-0.812484  0.000090")
+set_tests_properties(long-heg_14_gamma-hf-1-16-totenergy PROPERTIES  DEPENDS "long-heg_14_gamma-hf-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/heg/heg_14_gamma/long-heg_14_gamma-hf-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;147;QMC_RUN_AND_CHECK;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;0;")
+add_test(long-heg_14_gamma-hf-1-16-variance "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "heg_long_HF" "-e" "2" "--va" " 0.193169  0.006142")
+set_tests_properties(long-heg_14_gamma-hf-1-16-variance PROPERTIES  DEPENDS "long-heg_14_gamma-hf-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/heg/heg_14_gamma/long-heg_14_gamma-hf-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;147;QMC_RUN_AND_CHECK;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;0;")
+add_test(long-heg_14_gamma-sj-1-16 "/root/repo/_complex_build/bin/qmcpack" "heg-long-SJ.xml")
+set_tests_properties(long-heg_14_gamma-sj-1-16 PROPERTIES  ENVIRONMENT "OMP_NUM_THREADS=16" FAIL_REGULAR_EXPRESSION "" LABELS "cause_unknown;intermittent_stat_fail;quality_unknown;QMCPACK" PROCESSORS "16" PROCESSOR_AFFINITY "TRUE" WORKING_DIRECTORY "/root/repo/_complex_build/tests/heg/heg_14_gamma/long-heg_14_gamma-sj-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;101;ADD_TEST;/root/repo/CMake/macros.cmake;124;RUN_QMC_APP_NO_COPY;/root/repo/CMake/macros.cmake;167;RUN_QMC_APP;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;162;QMC_RUN_AND_CHECK;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;0;")
+add_test(long-heg_14_gamma-sj-1-16-totenergy "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "heg_long_SJ" "-e" "2" "--le" "-1.073323  0.000090")
+set_tests_properties(long-heg_14_gamma-sj-1-16-totenergy PROPERTIES  DEPENDS "long-heg_14_gamma-sj-1-16" LABELS "QMCPACK-checking-results;unstable;cause_unknown;intermittent_stat_fail;quality_unknown" WORKING_DIRECTORY "/root/repo/_complex_build/tests/heg/heg_14_gamma/long-heg_14_gamma-sj-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;162;QMC_RUN_AND_CHECK;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;0;")
+add_test(long-heg_14_gamma-sj-1-16-variance "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "heg_long_SJ" "-e" "2" "--va" " 0.024574  0.000060")
+set_tests_properties(long-heg_14_gamma-sj-1-16-variance PROPERTIES  DEPENDS "long-heg_14_gamma-sj-1-16" LABELS "QMCPACK-checking-results;unstable;cause_unknown;intermittent_stat_fail;quality_unknown" WORKING_DIRECTORY "/root/repo/_complex_build/tests/heg/heg_14_gamma/long-heg_14_gamma-sj-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;162;QMC_RUN_AND_CHECK;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;0;")
+add_test(long-heg_14_gamma-sj_new-1-16 "/root/repo/_complex_build/bin/qmcpack" "heg-long-SJ-new.xml")
+set_tests_properties(long-heg_14_gamma-sj_new-1-16 PROPERTIES  ENVIRONMENT "OMP_NUM_THREADS=16" FAIL_REGULAR_EXPRESSION "" LABELS "quality_unknown;QMCPACK" PROCESSORS "16" PROCESSOR_AFFINITY "TRUE" WORKING_DIRECTORY "/root/repo/_complex_build/tests/heg/heg_14_gamma/long-heg_14_gamma-sj_new-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;101;ADD_TEST;/root/repo/CMake/macros.cmake;124;RUN_QMC_APP_NO_COPY;/root/repo/CMake/macros.cmake;167;RUN_QMC_APP;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;177;QMC_RUN_AND_CHECK;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;0;")
+add_test(long-heg_14_gamma-sj_new-1-16-totenergy "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "heg_long_SJ_new" "-e" "2" "--le" "-1.073286  0.000090")
+set_tests_properties(long-heg_14_gamma-sj_new-1-16-totenergy PROPERTIES  DEPENDS "long-heg_14_gamma-sj_new-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/heg/heg_14_gamma/long-heg_14_gamma-sj_new-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;177;QMC_RUN_AND_CHECK;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;0;")
+add_test(long-heg_14_gamma-sj_new-1-16-variance "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "heg_long_SJ_new" "-e" "2" "--va" " 0.024564  0.000113")
+set_tests_properties(long-heg_14_gamma-sj_new-1-16-variance PROPERTIES  DEPENDS "long-heg_14_gamma-sj_new-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/heg/heg_14_gamma/long-heg_14_gamma-sj_new-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;177;QMC_RUN_AND_CHECK;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;0;")
+add_test(long-heg_14_gamma-sj_dmc-1-16 "/root/repo/_complex_build/bin/qmcpack" "heg-long-SJ-dmc.xml")
+set_tests_properties(long-heg_14_gamma-sj_dmc-1-16 PROPERTIES  ENVIRONMENT "OMP_NUM_THREADS=16" FAIL_REGULAR_EXPRESSION "" LABELS "quality_unknown;QMCPACK" PROCESSORS "16" PROCESSOR_AFFINITY "TRUE" WORKING_DIRECTORY "/root/repo/_complex_build/tests/heg/heg_14_gamma/long-heg_14_gamma-sj_dmc-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;101;ADD_TEST;/root/repo/CMake/macros.cmake;124;RUN_QMC_APP_NO_COPY;/root/repo/CMake/macros.cmake;167;RUN_QMC_APP;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;192;QMC_RUN_AND_CHECK;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;0;")
+add_test(long-heg_14_gamma-sj_dmc-1-16-totenergy "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "2" "-p" "heg_long_SJ_dmc" "-e" "2" "--le" "-1.110199  0.000106")
+set_tests_properties(long-heg_14_gamma-sj_dmc-1-16-totenergy PROPERTIES  DEPENDS "long-heg_14_gamma-sj_dmc-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/heg/heg_14_gamma/long-heg_14_gamma-sj_dmc-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;192;QMC_RUN_AND_CHECK;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;0;")
+add_test(long-heg_14_gamma-sj_dmc-1-16-variance "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "2" "-p" "heg_long_SJ_dmc" "-e" "2" "--va" " 0.022894  0.000020")
+set_tests_properties(long-heg_14_gamma-sj_dmc-1-16-variance PROPERTIES  DEPENDS "long-heg_14_gamma-sj_dmc-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/heg/heg_14_gamma/long-heg_14_gamma-sj_dmc-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;192;QMC_RUN_AND_CHECK;/root/repo/tests/heg/heg_14_gamma/CMakeLists.txt;0;")
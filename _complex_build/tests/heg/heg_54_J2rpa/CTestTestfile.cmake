@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/heg/heg_54_J2rpa
+# Build directory: /root/repo/_complex_build/tests/heg/heg_54_J2rpa
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
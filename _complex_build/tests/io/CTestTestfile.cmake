@@ -0,0 +1,18 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/io
+# Build directory: /root/repo/_complex_build/tests/io
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(restart-1-16 "/root/repo/_complex_build/bin/qmcpack" "qmc_short.in.xml")
+set_tests_properties(restart-1-16 PROPERTIES  ENVIRONMENT "OMP_NUM_THREADS=16" FAIL_REGULAR_EXPRESSION "" LABELS "quality_unknown;coverage" PROCESSORS "16" PROCESSOR_AFFINITY "TRUE" WORKING_DIRECTORY "/root/repo/_complex_build/tests/io/restart-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;101;ADD_TEST;/root/repo/CMake/macros.cmake;124;RUN_QMC_APP_NO_COPY;/root/repo/tests/io/CMakeLists.txt;21;RUN_QMC_APP;/root/repo/tests/io/CMakeLists.txt;60;RUN_RESTART_AND_CHECK;/root/repo/tests/io/CMakeLists.txt;0;")
+add_test(restart-1-16-restart "/root/repo/_complex_build/bin/qmcpack" "qmc_short.restart.xml")
+set_tests_properties(restart-1-16-restart PROPERTIES  DEPENDS "restart-1-16" ENVIRONMENT "OMP_NUM_THREADS=16" FAIL_REGULAR_EXPRESSION "" LABELS "quality_unknown;coverage" PROCESSORS "16" PROCESSOR_AFFINITY "TRUE" WORKING_DIRECTORY "/root/repo/_complex_build/tests/io/restart-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;101;ADD_TEST;/root/repo/tests/io/CMakeLists.txt;28;RUN_QMC_APP_NO_COPY;/root/repo/tests/io/CMakeLists.txt;60;RUN_RESTART_AND_CHECK;/root/repo/tests/io/CMakeLists.txt;0;")
+add_test(restart-1-16-check "/root/repo/_complex_build/tests/io/restart-1-16/check.sh")
+set_tests_properties(restart-1-16-check PROPERTIES  DEPENDS "restart-1-16-restart" LABELS "quality_unknown" WORKING_DIRECTORY "/root/repo/_complex_build/tests/io/restart-1-16" _BACKTRACE_TRIPLES "/root/repo/tests/io/CMakeLists.txt;46;add_test;/root/repo/tests/io/CMakeLists.txt;60;RUN_RESTART_AND_CHECK;/root/repo/tests/io/CMakeLists.txt;0;")
+add_test(save_coefs-1-16 "/root/repo/_complex_build/bin/qmcpack" "qmc_short.in.xml")
+set_tests_properties(save_coefs-1-16 PROPERTIES  ENVIRONMENT "OMP_NUM_THREADS=16" FAIL_REGULAR_EXPRESSION "" LABELS "quality_unknown;coverage" PROCESSORS "16" PROCESSOR_AFFINITY "TRUE" WORKING_DIRECTORY "/root/repo/_complex_build/tests/io/save_coefs-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;101;ADD_TEST;/root/repo/CMake/macros.cmake;124;RUN_QMC_APP_NO_COPY;/root/repo/tests/io/CMakeLists.txt;21;RUN_QMC_APP;/root/repo/tests/io/CMakeLists.txt;63;RUN_RESTART_AND_CHECK;/root/repo/tests/io/CMakeLists.txt;0;")
+add_test(save_coefs-1-16-restart "/root/repo/_complex_build/bin/qmcpack" "qmc_short.restart.xml")
+set_tests_properties(save_coefs-1-16-restart PROPERTIES  DEPENDS "save_coefs-1-16" ENVIRONMENT "OMP_NUM_THREADS=16" FAIL_REGULAR_EXPRESSION "" LABELS "quality_unknown;coverage" PROCESSORS "16" PROCESSOR_AFFINITY "TRUE" WORKING_DIRECTORY "/root/repo/_complex_build/tests/io/save_coefs-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;101;ADD_TEST;/root/repo/tests/io/CMakeLists.txt;28;RUN_QMC_APP_NO_COPY;/root/repo/tests/io/CMakeLists.txt;63;RUN_RESTART_AND_CHECK;/root/repo/tests/io/CMakeLists.txt;0;")
+add_test(save_coefs-1-16-check "/root/repo/_complex_build/tests/io/save_coefs-1-16/check.sh")
+set_tests_properties(save_coefs-1-16-check PROPERTIES  DEPENDS "save_coefs-1-16-restart" LABELS "quality_unknown" WORKING_DIRECTORY "/root/repo/_complex_build/tests/io/save_coefs-1-16" _BACKTRACE_TRIPLES "/root/repo/tests/io/CMakeLists.txt;46;add_test;/root/repo/tests/io/CMakeLists.txt;63;RUN_RESTART_AND_CHECK;/root/repo/tests/io/CMakeLists.txt;0;")
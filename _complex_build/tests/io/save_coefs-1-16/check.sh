@@ -0,0 +1,3 @@
+#!/bin/bash
+
+[[ -f qmc_short.s002.scalar.dat ]]
@@ -0,0 +1,30 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/models
+# Build directory: /root/repo/_complex_build/tests/models
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(short-sho-vmc-1-16 "/root/repo/_complex_build/bin/qmcpack" "vmc_sho.xml")
+set_tests_properties(short-sho-vmc-1-16 PROPERTIES  ENVIRONMENT "OMP_NUM_THREADS=16" FAIL_REGULAR_EXPRESSION "" LABELS "quality_unknown;QMCPACK" PROCESSORS "16" PROCESSOR_AFFINITY "TRUE" WORKING_DIRECTORY "/root/repo/_complex_build/tests/models/short-sho-vmc-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;101;ADD_TEST;/root/repo/CMake/macros.cmake;124;RUN_QMC_APP_NO_COPY;/root/repo/CMake/macros.cmake;167;RUN_QMC_APP;/root/repo/tests/models/CMakeLists.txt;23;QMC_RUN_AND_CHECK;/root/repo/tests/models/CMakeLists.txt;0;")
+add_test(short-sho-vmc-1-16-kinetic "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "m5" "-e" "2" "--ke" "0.225 0.0028")
+set_tests_properties(short-sho-vmc-1-16-kinetic PROPERTIES  DEPENDS "short-sho-vmc-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/models/short-sho-vmc-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/models/CMakeLists.txt;23;QMC_RUN_AND_CHECK;/root/repo/tests/models/CMakeLists.txt;0;")
+add_test(short-sho-vmc-1-16-totenergy "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "m5" "-e" "2" "--le" "0.45  4.0e-14")
+set_tests_properties(short-sho-vmc-1-16-totenergy PROPERTIES  DEPENDS "short-sho-vmc-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/models/short-sho-vmc-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/models/CMakeLists.txt;23;QMC_RUN_AND_CHECK;/root/repo/tests/models/CMakeLists.txt;0;")
+add_test(short-sho-vmc-1-16-potential "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "m5" "-e" "2" "--lp" "0.225 0.0028")
+set_tests_properties(short-sho-vmc-1-16-potential PROPERTIES  DEPENDS "short-sho-vmc-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/models/short-sho-vmc-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/models/CMakeLists.txt;23;QMC_RUN_AND_CHECK;/root/repo/tests/models/CMakeLists.txt;0;")
+add_test(short-sho-vmc-1-16-latdev "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "m5" "-e" "2" "--latdev" "1.0   0.013")
+set_tests_properties(short-sho-vmc-1-16-latdev PROPERTIES  DEPENDS "short-sho-vmc-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/models/short-sho-vmc-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/models/CMakeLists.txt;23;QMC_RUN_AND_CHECK;/root/repo/tests/models/CMakeLists.txt;0;")
+add_test(short-sho-grad_lap-1-1 "/root/repo/_complex_build/bin/qmcpack" "grad_lap.xml")
+set_tests_properties(short-sho-grad_lap-1-1 PROPERTIES  ENVIRONMENT "OMP_NUM_THREADS=1" FAIL_REGULAR_EXPRESSION "" LABELS "quality_unknown" PROCESSORS "1" PROCESSOR_AFFINITY "TRUE" WORKING_DIRECTORY "/root/repo/_complex_build/tests/models/short-sho-grad_lap-1-1" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;101;ADD_TEST;/root/repo/CMake/macros.cmake;124;RUN_QMC_APP_NO_COPY;/root/repo/CMake/macros.cmake;245;RUN_QMC_APP;/root/repo/tests/models/CMakeLists.txt;32;SIMPLE_RUN_AND_CHECK;/root/repo/tests/models/CMakeLists.txt;0;")
+add_test(short-sho-grad_lap-1-1-check "/root/repo/tests/scripts/check_grad_lap.py")
+set_tests_properties(short-sho-grad_lap-1-1-check PROPERTIES  DEPENDS "short-sho-grad_lap-1-1" LABELS "quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/models/short-sho-grad_lap-1-1" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;265;add_test;/root/repo/tests/models/CMakeLists.txt;32;SIMPLE_RUN_AND_CHECK;/root/repo/tests/models/CMakeLists.txt;0;")
+add_test(short-grid_ext_pot-vmc-1-16 "/root/repo/_complex_build/bin/qmcpack" "vmc_grid_ext_pot.xml")
+set_tests_properties(short-grid_ext_pot-vmc-1-16 PROPERTIES  ENVIRONMENT "OMP_NUM_THREADS=16" FAIL_REGULAR_EXPRESSION "" LABELS "quality_unknown;QMCPACK" PROCESSORS "16" PROCESSOR_AFFINITY "TRUE" WORKING_DIRECTORY "/root/repo/_complex_build/tests/models/short-grid_ext_pot-vmc-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;101;ADD_TEST;/root/repo/CMake/macros.cmake;124;RUN_QMC_APP_NO_COPY;/root/repo/CMake/macros.cmake;167;RUN_QMC_APP;/root/repo/tests/models/CMakeLists.txt;39;QMC_RUN_AND_CHECK;/root/repo/tests/models/CMakeLists.txt;0;")
+add_test(short-grid_ext_pot-vmc-1-16-kinetic "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "grid_ext_pot" "-e" "2" "--ke" "0.225 0.0028")
+set_tests_properties(short-grid_ext_pot-vmc-1-16-kinetic PROPERTIES  DEPENDS "short-grid_ext_pot-vmc-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/models/short-grid_ext_pot-vmc-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/models/CMakeLists.txt;39;QMC_RUN_AND_CHECK;/root/repo/tests/models/CMakeLists.txt;0;")
+add_test(short-grid_ext_pot-vmc-1-16-totenergy "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "grid_ext_pot" "-e" "2" "--le" "0.45  1e-6")
+set_tests_properties(short-grid_ext_pot-vmc-1-16-totenergy PROPERTIES  DEPENDS "short-grid_ext_pot-vmc-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/models/short-grid_ext_pot-vmc-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/models/CMakeLists.txt;39;QMC_RUN_AND_CHECK;/root/repo/tests/models/CMakeLists.txt;0;")
+add_test(short-grid_ext_pot-vmc-1-16-potential "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "grid_ext_pot" "-e" "2" "--lp" "0.225 0.0028")
+set_tests_properties(short-grid_ext_pot-vmc-1-16-potential PROPERTIES  DEPENDS "short-grid_ext_pot-vmc-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/models/short-grid_ext_pot-vmc-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/models/CMakeLists.txt;39;QMC_RUN_AND_CHECK;/root/repo/tests/models/CMakeLists.txt;0;")
+add_test(short-grid_ext_pot-vmc-1-16-latdev "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "grid_ext_pot" "-e" "2" "--latdev" "1.0   0.013")
+set_tests_properties(short-grid_ext_pot-vmc-1-16-latdev PROPERTIES  DEPENDS "short-grid_ext_pot-vmc-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/models/short-grid_ext_pot-vmc-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/models/CMakeLists.txt;39;QMC_RUN_AND_CHECK;/root/repo/tests/models/CMakeLists.txt;0;")
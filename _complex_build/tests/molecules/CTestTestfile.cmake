@@ -0,0 +1,21 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/molecules
+# Build directory: /root/repo/_complex_build/tests/molecules
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("Li2_STO_ae")
+subdirs("C2_pp")
+subdirs("LiH_dimer_ae_gms")
+subdirs("LiH_dimer_ae_pyscf")
+subdirs("LiH_dimer_ae_qp")
+subdirs("LiH_dimer_pp")
+subdirs("H2_ae")
+subdirs("H4_ae")
+subdirs("H4_msd_ae")
+subdirs("H2O_dimer_sep_pp")
+subdirs("FeCO6_b3lyp_gms")
+subdirs("FeCO6_b3lyp_pyscf")
+subdirs("CHN_ae")
+subdirs("LiH_ae_MSD")
+subdirs("He_ae")
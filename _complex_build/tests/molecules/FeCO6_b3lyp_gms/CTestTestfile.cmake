@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/molecules/FeCO6_b3lyp_gms
+# Build directory: /root/repo/_complex_build/tests/molecules/FeCO6_b3lyp_gms
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/molecules/H2O_dimer_sep_pp
+# Build directory: /root/repo/_complex_build/tests/molecules/H2O_dimer_sep_pp
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/molecules/H4_msd_ae
+# Build directory: /root/repo/_complex_build/tests/molecules/H4_msd_ae
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
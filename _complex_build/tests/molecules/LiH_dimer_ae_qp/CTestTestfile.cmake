@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/molecules/LiH_dimer_ae_qp
+# Build directory: /root/repo/_complex_build/tests/molecules/LiH_dimer_ae_qp
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
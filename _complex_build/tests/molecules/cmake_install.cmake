@@ -0,0 +1,64 @@
+# Install script for directory: /root/repo/tests/molecules
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "RELEASE")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(NOT CMAKE_INSTALL_LOCAL_ONLY)
+  # Include the install script for each subdirectory.
+  include("/root/repo/_complex_build/tests/molecules/Li2_STO_ae/cmake_install.cmake")
+  include("/root/repo/_complex_build/tests/molecules/C2_pp/cmake_install.cmake")
+  include("/root/repo/_complex_build/tests/molecules/LiH_dimer_ae_gms/cmake_install.cmake")
+  include("/root/repo/_complex_build/tests/molecules/LiH_dimer_ae_pyscf/cmake_install.cmake")
+  include("/root/repo/_complex_build/tests/molecules/LiH_dimer_ae_qp/cmake_install.cmake")
+  include("/root/repo/_complex_build/tests/molecules/LiH_dimer_pp/cmake_install.cmake")
+  include("/root/repo/_complex_build/tests/molecules/H2_ae/cmake_install.cmake")
+  include("/root/repo/_complex_build/tests/molecules/H4_ae/cmake_install.cmake")
+  include("/root/repo/_complex_build/tests/molecules/H4_msd_ae/cmake_install.cmake")
+  include("/root/repo/_complex_build/tests/molecules/H2O_dimer_sep_pp/cmake_install.cmake")
+  include("/root/repo/_complex_build/tests/molecules/FeCO6_b3lyp_gms/cmake_install.cmake")
+  include("/root/repo/_complex_build/tests/molecules/FeCO6_b3lyp_pyscf/cmake_install.cmake")
+  include("/root/repo/_complex_build/tests/molecules/CHN_ae/cmake_install.cmake")
+  include("/root/repo/_complex_build/tests/molecules/LiH_ae_MSD/cmake_install.cmake")
+  include("/root/repo/_complex_build/tests/molecules/He_ae/cmake_install.cmake")
+
+endif()
+
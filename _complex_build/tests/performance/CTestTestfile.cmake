@@ -0,0 +1,9 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/performance
+# Build directory: /root/repo/_complex_build/tests/performance
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("NiO")
+subdirs("C-graphite")
+subdirs("C-molecule")
@@ -0,0 +1,42 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/solids/Al-1x1x1-Gaussian_pp_ShiftedTwist
+# Build directory: /root/repo/_complex_build/tests/solids/Al-1x1x1-Gaussian_pp_ShiftedTwist
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(long-Al-1x1x1-Gaussian-pp-cplx-1-16 "/root/repo/_complex_build/bin/qmcpack" "vmc_long.in.xml")
+set_tests_properties(long-Al-1x1x1-Gaussian-pp-cplx-1-16 PROPERTIES  ENVIRONMENT "OMP_NUM_THREADS=16" FAIL_REGULAR_EXPRESSION "" LABELS "quality_unknown;QMCPACK" PROCESSORS "16" PROCESSOR_AFFINITY "TRUE" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/Al-1x1x1-Gaussian_pp_ShiftedTwist/long-Al-1x1x1-Gaussian-pp-cplx-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;101;ADD_TEST;/root/repo/CMake/macros.cmake;124;RUN_QMC_APP_NO_COPY;/root/repo/CMake/macros.cmake;167;RUN_QMC_APP;/root/repo/tests/solids/Al-1x1x1-Gaussian_pp_ShiftedTwist/CMakeLists.txt;16;QMC_RUN_AND_CHECK;/root/repo/tests/solids/Al-1x1x1-Gaussian_pp_ShiftedTwist/CMakeLists.txt;0;")
+add_test(long-Al-1x1x1-Gaussian-pp-cplx-1-16-kinetic "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "vmc_long" "-e" "2" "--ke" "3.564934899261 0.010603465208")
+set_tests_properties(long-Al-1x1x1-Gaussian-pp-cplx-1-16-kinetic PROPERTIES  DEPENDS "long-Al-1x1x1-Gaussian-pp-cplx-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/Al-1x1x1-Gaussian_pp_ShiftedTwist/long-Al-1x1x1-Gaussian-pp-cplx-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/solids/Al-1x1x1-Gaussian_pp_ShiftedTwist/CMakeLists.txt;16;QMC_RUN_AND_CHECK;/root/repo/tests/solids/Al-1x1x1-Gaussian_pp_ShiftedTwist/CMakeLists.txt;0;")
+add_test(long-Al-1x1x1-Gaussian-pp-cplx-1-16-totenergy "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "vmc_long" "-e" "2" "--le" "-8.072494830814307 0.014895296777")
+set_tests_properties(long-Al-1x1x1-Gaussian-pp-cplx-1-16-totenergy PROPERTIES  DEPENDS "long-Al-1x1x1-Gaussian-pp-cplx-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/Al-1x1x1-Gaussian_pp_ShiftedTwist/long-Al-1x1x1-Gaussian-pp-cplx-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/solids/Al-1x1x1-Gaussian_pp_ShiftedTwist/CMakeLists.txt;16;QMC_RUN_AND_CHECK;/root/repo/tests/solids/Al-1x1x1-Gaussian_pp_ShiftedTwist/CMakeLists.txt;0;")
+add_test(long-Al-1x1x1-Gaussian-pp-cplx-1-16-variance "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "vmc_long" "-e" "2" "--va" "0.929704520713 0.035362222511")
+set_tests_properties(long-Al-1x1x1-Gaussian-pp-cplx-1-16-variance PROPERTIES  DEPENDS "long-Al-1x1x1-Gaussian-pp-cplx-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/Al-1x1x1-Gaussian_pp_ShiftedTwist/long-Al-1x1x1-Gaussian-pp-cplx-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/solids/Al-1x1x1-Gaussian_pp_ShiftedTwist/CMakeLists.txt;16;QMC_RUN_AND_CHECK;/root/repo/tests/solids/Al-1x1x1-Gaussian_pp_ShiftedTwist/CMakeLists.txt;0;")
+add_test(long-Al-1x1x1-Gaussian-pp-cplx-1-16-eeenergy "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "vmc_long" "-e" "2" "--ee" "-3.109468568661 0.014478131707")
+set_tests_properties(long-Al-1x1x1-Gaussian-pp-cplx-1-16-eeenergy PROPERTIES  DEPENDS "long-Al-1x1x1-Gaussian-pp-cplx-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/Al-1x1x1-Gaussian_pp_ShiftedTwist/long-Al-1x1x1-Gaussian-pp-cplx-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/solids/Al-1x1x1-Gaussian_pp_ShiftedTwist/CMakeLists.txt;16;QMC_RUN_AND_CHECK;/root/repo/tests/solids/Al-1x1x1-Gaussian_pp_ShiftedTwist/CMakeLists.txt;0;")
+add_test(long-Al-1x1x1-Gaussian-pp-cplx-1-16-potential "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "vmc_long" "-e" "2" "--lp" "-11.637571841025 0.015954075009")
+set_tests_properties(long-Al-1x1x1-Gaussian-pp-cplx-1-16-potential PROPERTIES  DEPENDS "long-Al-1x1x1-Gaussian-pp-cplx-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/Al-1x1x1-Gaussian_pp_ShiftedTwist/long-Al-1x1x1-Gaussian-pp-cplx-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/solids/Al-1x1x1-Gaussian_pp_ShiftedTwist/CMakeLists.txt;16;QMC_RUN_AND_CHECK;/root/repo/tests/solids/Al-1x1x1-Gaussian_pp_ShiftedTwist/CMakeLists.txt;0;")
+add_test(long-Al-1x1x1-Gaussian-pp-cplx-1-16-ionion "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "vmc_long" "-e" "2" "--ii" "-10.812685912000 0.020000000000")
+set_tests_properties(long-Al-1x1x1-Gaussian-pp-cplx-1-16-ionion PROPERTIES  DEPENDS "long-Al-1x1x1-Gaussian-pp-cplx-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/Al-1x1x1-Gaussian_pp_ShiftedTwist/long-Al-1x1x1-Gaussian-pp-cplx-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/solids/Al-1x1x1-Gaussian_pp_ShiftedTwist/CMakeLists.txt;16;QMC_RUN_AND_CHECK;/root/repo/tests/solids/Al-1x1x1-Gaussian_pp_ShiftedTwist/CMakeLists.txt;0;")
+add_test(long-Al-1x1x1-Gaussian-pp-cplx-1-16-localecp "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "vmc_long" "-e" "2" "--lpp" "0.693022086548 0.015917294909")
+set_tests_properties(long-Al-1x1x1-Gaussian-pp-cplx-1-16-localecp PROPERTIES  DEPENDS "long-Al-1x1x1-Gaussian-pp-cplx-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/Al-1x1x1-Gaussian_pp_ShiftedTwist/long-Al-1x1x1-Gaussian-pp-cplx-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/solids/Al-1x1x1-Gaussian_pp_ShiftedTwist/CMakeLists.txt;16;QMC_RUN_AND_CHECK;/root/repo/tests/solids/Al-1x1x1-Gaussian_pp_ShiftedTwist/CMakeLists.txt;0;")
+add_test(long-Al-1x1x1-Gaussian-pp-cplx-1-16-nonlocalecp "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "vmc_long" "-e" "2" "--nlpp" "1.591560552665 0.016677475370")
+set_tests_properties(long-Al-1x1x1-Gaussian-pp-cplx-1-16-nonlocalecp PROPERTIES  DEPENDS "long-Al-1x1x1-Gaussian-pp-cplx-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/Al-1x1x1-Gaussian_pp_ShiftedTwist/long-Al-1x1x1-Gaussian-pp-cplx-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/solids/Al-1x1x1-Gaussian_pp_ShiftedTwist/CMakeLists.txt;16;QMC_RUN_AND_CHECK;/root/repo/tests/solids/Al-1x1x1-Gaussian_pp_ShiftedTwist/CMakeLists.txt;0;")
+add_test(short-Al-1x1x1-Gaussian-pp-cplx-1-16 "/root/repo/_complex_build/bin/qmcpack" "vmc_short.in.xml")
+set_tests_properties(short-Al-1x1x1-Gaussian-pp-cplx-1-16 PROPERTIES  ENVIRONMENT "OMP_NUM_THREADS=16" FAIL_REGULAR_EXPRESSION "" LABELS "quality_unknown;QMCPACK" PROCESSORS "16" PROCESSOR_AFFINITY "TRUE" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/Al-1x1x1-Gaussian_pp_ShiftedTwist/short-Al-1x1x1-Gaussian-pp-cplx-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;101;ADD_TEST;/root/repo/CMake/macros.cmake;124;RUN_QMC_APP_NO_COPY;/root/repo/CMake/macros.cmake;167;RUN_QMC_APP;/root/repo/tests/solids/Al-1x1x1-Gaussian_pp_ShiftedTwist/CMakeLists.txt;36;QMC_RUN_AND_CHECK;/root/repo/tests/solids/Al-1x1x1-Gaussian_pp_ShiftedTwist/CMakeLists.txt;0;")
+add_test(short-Al-1x1x1-Gaussian-pp-cplx-1-16-kinetic "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "vmc_short" "-e" "2" "--ke" "3.564934899261 0.015825393834")
+set_tests_properties(short-Al-1x1x1-Gaussian-pp-cplx-1-16-kinetic PROPERTIES  DEPENDS "short-Al-1x1x1-Gaussian-pp-cplx-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/Al-1x1x1-Gaussian_pp_ShiftedTwist/short-Al-1x1x1-Gaussian-pp-cplx-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/solids/Al-1x1x1-Gaussian_pp_ShiftedTwist/CMakeLists.txt;36;QMC_RUN_AND_CHECK;/root/repo/tests/solids/Al-1x1x1-Gaussian_pp_ShiftedTwist/CMakeLists.txt;0;")
+add_test(short-Al-1x1x1-Gaussian-pp-cplx-1-16-totenergy "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "vmc_short" "-e" "2" "--le" "-8.072494830814307 0.025268003771")
+set_tests_properties(short-Al-1x1x1-Gaussian-pp-cplx-1-16-totenergy PROPERTIES  DEPENDS "short-Al-1x1x1-Gaussian-pp-cplx-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/Al-1x1x1-Gaussian_pp_ShiftedTwist/short-Al-1x1x1-Gaussian-pp-cplx-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/solids/Al-1x1x1-Gaussian_pp_ShiftedTwist/CMakeLists.txt;36;QMC_RUN_AND_CHECK;/root/repo/tests/solids/Al-1x1x1-Gaussian_pp_ShiftedTwist/CMakeLists.txt;0;")
+add_test(short-Al-1x1x1-Gaussian-pp-cplx-1-16-variance "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "vmc_short" "-e" "2" "--va" "0.929704520713 0.046252853972")
+set_tests_properties(short-Al-1x1x1-Gaussian-pp-cplx-1-16-variance PROPERTIES  DEPENDS "short-Al-1x1x1-Gaussian-pp-cplx-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/Al-1x1x1-Gaussian_pp_ShiftedTwist/short-Al-1x1x1-Gaussian-pp-cplx-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/solids/Al-1x1x1-Gaussian_pp_ShiftedTwist/CMakeLists.txt;36;QMC_RUN_AND_CHECK;/root/repo/tests/solids/Al-1x1x1-Gaussian_pp_ShiftedTwist/CMakeLists.txt;0;")
+add_test(short-Al-1x1x1-Gaussian-pp-cplx-1-16-eeenergy "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "vmc_short" "-e" "2" "--ee" "-3.109468568661 0.026007614629")
+set_tests_properties(short-Al-1x1x1-Gaussian-pp-cplx-1-16-eeenergy PROPERTIES  DEPENDS "short-Al-1x1x1-Gaussian-pp-cplx-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/Al-1x1x1-Gaussian_pp_ShiftedTwist/short-Al-1x1x1-Gaussian-pp-cplx-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/solids/Al-1x1x1-Gaussian_pp_ShiftedTwist/CMakeLists.txt;36;QMC_RUN_AND_CHECK;/root/repo/tests/solids/Al-1x1x1-Gaussian_pp_ShiftedTwist/CMakeLists.txt;0;")
+add_test(short-Al-1x1x1-Gaussian-pp-cplx-1-16-potential "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "vmc_short" "-e" "2" "--lp" "-11.637571841025 0.029573348064")
+set_tests_properties(short-Al-1x1x1-Gaussian-pp-cplx-1-16-potential PROPERTIES  DEPENDS "short-Al-1x1x1-Gaussian-pp-cplx-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/Al-1x1x1-Gaussian_pp_ShiftedTwist/short-Al-1x1x1-Gaussian-pp-cplx-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/solids/Al-1x1x1-Gaussian_pp_ShiftedTwist/CMakeLists.txt;36;QMC_RUN_AND_CHECK;/root/repo/tests/solids/Al-1x1x1-Gaussian_pp_ShiftedTwist/CMakeLists.txt;0;")
+add_test(short-Al-1x1x1-Gaussian-pp-cplx-1-16-ionion "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "vmc_short" "-e" "2" "--ii" "-10.812685912000 0.020000000000")
+set_tests_properties(short-Al-1x1x1-Gaussian-pp-cplx-1-16-ionion PROPERTIES  DEPENDS "short-Al-1x1x1-Gaussian-pp-cplx-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/Al-1x1x1-Gaussian_pp_ShiftedTwist/short-Al-1x1x1-Gaussian-pp-cplx-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/solids/Al-1x1x1-Gaussian_pp_ShiftedTwist/CMakeLists.txt;36;QMC_RUN_AND_CHECK;/root/repo/tests/solids/Al-1x1x1-Gaussian_pp_ShiftedTwist/CMakeLists.txt;0;")
+add_test(short-Al-1x1x1-Gaussian-pp-cplx-1-16-localecp "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "vmc_short" "-e" "2" "--lpp" "0.693022086548 0.049611353506")
+set_tests_properties(short-Al-1x1x1-Gaussian-pp-cplx-1-16-localecp PROPERTIES  DEPENDS "short-Al-1x1x1-Gaussian-pp-cplx-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/Al-1x1x1-Gaussian_pp_ShiftedTwist/short-Al-1x1x1-Gaussian-pp-cplx-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/solids/Al-1x1x1-Gaussian_pp_ShiftedTwist/CMakeLists.txt;36;QMC_RUN_AND_CHECK;/root/repo/tests/solids/Al-1x1x1-Gaussian_pp_ShiftedTwist/CMakeLists.txt;0;")
+add_test(short-Al-1x1x1-Gaussian-pp-cplx-1-16-nonlocalecp "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "vmc_short" "-e" "2" "--nlpp" "1.591560552665 0.047099343376")
+set_tests_properties(short-Al-1x1x1-Gaussian-pp-cplx-1-16-nonlocalecp PROPERTIES  DEPENDS "short-Al-1x1x1-Gaussian-pp-cplx-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/Al-1x1x1-Gaussian_pp_ShiftedTwist/short-Al-1x1x1-Gaussian-pp-cplx-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/solids/Al-1x1x1-Gaussian_pp_ShiftedTwist/CMakeLists.txt;36;QMC_RUN_AND_CHECK;/root/repo/tests/solids/Al-1x1x1-Gaussian_pp_ShiftedTwist/CMakeLists.txt;0;")
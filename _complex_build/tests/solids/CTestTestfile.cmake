@@ -0,0 +1,24 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/solids
+# Build directory: /root/repo/_complex_build/tests/solids
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("LiH_solid_1x1x1_pp")
+subdirs("bccH_3x3x3_ae")
+subdirs("bccH_2x2x2_ae")
+subdirs("bccH_1x1x1_ae")
+subdirs("diamondC_1x1x1_pp")
+subdirs("diamondC_2x1x1_pp")
+subdirs("diamondC_1x1x1-Gaussian_pp")
+subdirs("diamondC_2x1x1-Gaussian_pp")
+subdirs("diamondC_2x1x1-Gaussian_pp_kpts")
+subdirs("hcpBe_1x1x1_pp")
+subdirs("monoO_1x1x1_pp")
+subdirs("NiO_a4_e48_pp")
+subdirs("grapheneC_1x1_pp")
+subdirs("diamondC_1x1x1-Gaussian_pp_Tw_cplx")
+subdirs("diamondC_2x1x1-Gaussian_pp_cplx")
+subdirs("diamondC_2x1x1-Gaussian_pp_cplx_MSD")
+subdirs("diamondC_1x1x1-Gaussian_pp_Tw_cplx_MSD")
+subdirs("Al-1x1x1-Gaussian_pp_ShiftedTwist")
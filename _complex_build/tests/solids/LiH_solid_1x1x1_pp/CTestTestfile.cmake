@@ -0,0 +1,108 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/solids/LiH_solid_1x1x1_pp
+# Build directory: /root/repo/_complex_build/tests/solids/LiH_solid_1x1x1_pp
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(short-LiH_solid_1x1x1_pp-gamma-vmc_hf_noj-1-16 "/root/repo/_complex_build/bin/qmcpack" "hf_vmc_LiH-gamma.xml")
+set_tests_properties(short-LiH_solid_1x1x1_pp-gamma-vmc_hf_noj-1-16 PROPERTIES  ENVIRONMENT "OMP_NUM_THREADS=16" FAIL_REGULAR_EXPRESSION "" LABELS "quality_unknown;QMCPACK" PROCESSORS "16" PROCESSOR_AFFINITY "TRUE" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/LiH_solid_1x1x1_pp/short-LiH_solid_1x1x1_pp-gamma-vmc_hf_noj-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;101;ADD_TEST;/root/repo/CMake/macros.cmake;124;RUN_QMC_APP_NO_COPY;/root/repo/CMake/macros.cmake;167;RUN_QMC_APP;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;10;QMC_RUN_AND_CHECK;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;0;")
+add_test(short-LiH_solid_1x1x1_pp-gamma-vmc_hf_noj-1-16-kinetic "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "hf_vmc_LiH-gamma" "-e" "2" "--ke" "7.4145221704067854 0.024")
+set_tests_properties(short-LiH_solid_1x1x1_pp-gamma-vmc_hf_noj-1-16-kinetic PROPERTIES  DEPENDS "short-LiH_solid_1x1x1_pp-gamma-vmc_hf_noj-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/LiH_solid_1x1x1_pp/short-LiH_solid_1x1x1_pp-gamma-vmc_hf_noj-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;10;QMC_RUN_AND_CHECK;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;0;")
+add_test(short-LiH_solid_1x1x1_pp-gamma-vmc_hf_noj-1-16-samples "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "hf_vmc_LiH-gamma" "-e" "2" "--ts" "1600000 0.0")
+set_tests_properties(short-LiH_solid_1x1x1_pp-gamma-vmc_hf_noj-1-16-samples PROPERTIES  DEPENDS "short-LiH_solid_1x1x1_pp-gamma-vmc_hf_noj-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/LiH_solid_1x1x1_pp/short-LiH_solid_1x1x1_pp-gamma-vmc_hf_noj-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;10;QMC_RUN_AND_CHECK;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;0;")
+add_test(short-LiH_solid_1x1x1_pp-gamma-vmc_hf_noj-1-16-localecp "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "hf_vmc_LiH-gamma" "-e" "2" "--lpp" "-11.718808431876706 0.025")
+set_tests_properties(short-LiH_solid_1x1x1_pp-gamma-vmc_hf_noj-1-16-localecp PROPERTIES  DEPENDS "short-LiH_solid_1x1x1_pp-gamma-vmc_hf_noj-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/LiH_solid_1x1x1_pp/short-LiH_solid_1x1x1_pp-gamma-vmc_hf_noj-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;10;QMC_RUN_AND_CHECK;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;0;")
+add_test(short-LiH_solid_1x1x1_pp-gamma-drift-vmc_hf_noj-1-16 "/root/repo/_complex_build/bin/qmcpack" "hf_vmc_LiH-gamma-drift.xml")
+set_tests_properties(short-LiH_solid_1x1x1_pp-gamma-drift-vmc_hf_noj-1-16 PROPERTIES  ENVIRONMENT "OMP_NUM_THREADS=16" FAIL_REGULAR_EXPRESSION "" LABELS "quality_unknown;QMCPACK" PROCESSORS "16" PROCESSOR_AFFINITY "TRUE" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/LiH_solid_1x1x1_pp/short-LiH_solid_1x1x1_pp-gamma-drift-vmc_hf_noj-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;101;ADD_TEST;/root/repo/CMake/macros.cmake;124;RUN_QMC_APP_NO_COPY;/root/repo/CMake/macros.cmake;167;RUN_QMC_APP;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;20;QMC_RUN_AND_CHECK;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;0;")
+add_test(short-LiH_solid_1x1x1_pp-gamma-drift-vmc_hf_noj-1-16-kinetic "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "hf_vmc_LiH-gamma-drift" "-e" "2" "--ke" "7.4145221704067854 0.024")
+set_tests_properties(short-LiH_solid_1x1x1_pp-gamma-drift-vmc_hf_noj-1-16-kinetic PROPERTIES  DEPENDS "short-LiH_solid_1x1x1_pp-gamma-drift-vmc_hf_noj-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/LiH_solid_1x1x1_pp/short-LiH_solid_1x1x1_pp-gamma-drift-vmc_hf_noj-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;20;QMC_RUN_AND_CHECK;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;0;")
+add_test(short-LiH_solid_1x1x1_pp-gamma-drift-vmc_hf_noj-1-16-samples "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "hf_vmc_LiH-gamma-drift" "-e" "2" "--ts" "1600000 0.0")
+set_tests_properties(short-LiH_solid_1x1x1_pp-gamma-drift-vmc_hf_noj-1-16-samples PROPERTIES  DEPENDS "short-LiH_solid_1x1x1_pp-gamma-drift-vmc_hf_noj-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/LiH_solid_1x1x1_pp/short-LiH_solid_1x1x1_pp-gamma-drift-vmc_hf_noj-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;20;QMC_RUN_AND_CHECK;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;0;")
+add_test(short-LiH_solid_1x1x1_pp-gamma-drift-vmc_hf_noj-1-16-localecp "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "hf_vmc_LiH-gamma-drift" "-e" "2" "--lpp" "-11.718808431876706 0.025")
+set_tests_properties(short-LiH_solid_1x1x1_pp-gamma-drift-vmc_hf_noj-1-16-localecp PROPERTIES  DEPENDS "short-LiH_solid_1x1x1_pp-gamma-drift-vmc_hf_noj-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/LiH_solid_1x1x1_pp/short-LiH_solid_1x1x1_pp-gamma-drift-vmc_hf_noj-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;20;QMC_RUN_AND_CHECK;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;0;")
+add_test(short-LiH_solid_1x1x1_pp-x-vmc_hf_noj-1-16 "/root/repo/_complex_build/bin/qmcpack" "hf_vmc_LiH-x.xml")
+set_tests_properties(short-LiH_solid_1x1x1_pp-x-vmc_hf_noj-1-16 PROPERTIES  ENVIRONMENT "OMP_NUM_THREADS=16" FAIL_REGULAR_EXPRESSION "" LABELS "quality_unknown;QMCPACK" PROCESSORS "16" PROCESSOR_AFFINITY "TRUE" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/LiH_solid_1x1x1_pp/short-LiH_solid_1x1x1_pp-x-vmc_hf_noj-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;101;ADD_TEST;/root/repo/CMake/macros.cmake;124;RUN_QMC_APP_NO_COPY;/root/repo/CMake/macros.cmake;167;RUN_QMC_APP;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;35;QMC_RUN_AND_CHECK;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;0;")
+add_test(short-LiH_solid_1x1x1_pp-x-vmc_hf_noj-1-16-kinetic "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "hf_vmc_LiH-x" "-e" "2" "--ke" "7.3772282047321536 0.024")
+set_tests_properties(short-LiH_solid_1x1x1_pp-x-vmc_hf_noj-1-16-kinetic PROPERTIES  DEPENDS "short-LiH_solid_1x1x1_pp-x-vmc_hf_noj-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/LiH_solid_1x1x1_pp/short-LiH_solid_1x1x1_pp-x-vmc_hf_noj-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;35;QMC_RUN_AND_CHECK;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;0;")
+add_test(short-LiH_solid_1x1x1_pp-x-vmc_hf_noj-1-16-samples "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "hf_vmc_LiH-x" "-e" "2" "--ts" "1600000 0.0")
+set_tests_properties(short-LiH_solid_1x1x1_pp-x-vmc_hf_noj-1-16-samples PROPERTIES  DEPENDS "short-LiH_solid_1x1x1_pp-x-vmc_hf_noj-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/LiH_solid_1x1x1_pp/short-LiH_solid_1x1x1_pp-x-vmc_hf_noj-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;35;QMC_RUN_AND_CHECK;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;0;")
+add_test(short-LiH_solid_1x1x1_pp-x-vmc_hf_noj-1-16-localecp "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "hf_vmc_LiH-x" "-e" "2" "--lpp" "-11.414410381100344 0.025")
+set_tests_properties(short-LiH_solid_1x1x1_pp-x-vmc_hf_noj-1-16-localecp PROPERTIES  DEPENDS "short-LiH_solid_1x1x1_pp-x-vmc_hf_noj-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/LiH_solid_1x1x1_pp/short-LiH_solid_1x1x1_pp-x-vmc_hf_noj-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;35;QMC_RUN_AND_CHECK;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;0;")
+add_test(short-LiH_solid_1x1x1_pp-x-drift-vmc_hf_noj-1-16 "/root/repo/_complex_build/bin/qmcpack" "hf_vmc_LiH-x-drift.xml")
+set_tests_properties(short-LiH_solid_1x1x1_pp-x-drift-vmc_hf_noj-1-16 PROPERTIES  ENVIRONMENT "OMP_NUM_THREADS=16" FAIL_REGULAR_EXPRESSION "" LABELS "quality_unknown;QMCPACK" PROCESSORS "16" PROCESSOR_AFFINITY "TRUE" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/LiH_solid_1x1x1_pp/short-LiH_solid_1x1x1_pp-x-drift-vmc_hf_noj-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;101;ADD_TEST;/root/repo/CMake/macros.cmake;124;RUN_QMC_APP_NO_COPY;/root/repo/CMake/macros.cmake;167;RUN_QMC_APP;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;44;QMC_RUN_AND_CHECK;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;0;")
+add_test(short-LiH_solid_1x1x1_pp-x-drift-vmc_hf_noj-1-16-kinetic "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "hf_vmc_LiH-x-drift" "-e" "2" "--ke" "7.3772282047321536 0.024")
+set_tests_properties(short-LiH_solid_1x1x1_pp-x-drift-vmc_hf_noj-1-16-kinetic PROPERTIES  DEPENDS "short-LiH_solid_1x1x1_pp-x-drift-vmc_hf_noj-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/LiH_solid_1x1x1_pp/short-LiH_solid_1x1x1_pp-x-drift-vmc_hf_noj-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;44;QMC_RUN_AND_CHECK;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;0;")
+add_test(short-LiH_solid_1x1x1_pp-x-drift-vmc_hf_noj-1-16-samples "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "hf_vmc_LiH-x-drift" "-e" "2" "--ts" "1600000 0.0")
+set_tests_properties(short-LiH_solid_1x1x1_pp-x-drift-vmc_hf_noj-1-16-samples PROPERTIES  DEPENDS "short-LiH_solid_1x1x1_pp-x-drift-vmc_hf_noj-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/LiH_solid_1x1x1_pp/short-LiH_solid_1x1x1_pp-x-drift-vmc_hf_noj-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;44;QMC_RUN_AND_CHECK;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;0;")
+add_test(short-LiH_solid_1x1x1_pp-x-drift-vmc_hf_noj-1-16-localecp "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "hf_vmc_LiH-x-drift" "-e" "2" "--lpp" "-11.414410381100344 0.025")
+set_tests_properties(short-LiH_solid_1x1x1_pp-x-drift-vmc_hf_noj-1-16-localecp PROPERTIES  DEPENDS "short-LiH_solid_1x1x1_pp-x-drift-vmc_hf_noj-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/LiH_solid_1x1x1_pp/short-LiH_solid_1x1x1_pp-x-drift-vmc_hf_noj-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;44;QMC_RUN_AND_CHECK;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;0;")
+add_test(short-LiH_solid_1x1x1_hybridrep_pp-x-vmc_hf_noj-1-16 "/root/repo/_complex_build/bin/qmcpack" "hf_vmc_LiH-x_hybridrep.xml")
+set_tests_properties(short-LiH_solid_1x1x1_hybridrep_pp-x-vmc_hf_noj-1-16 PROPERTIES  ENVIRONMENT "OMP_NUM_THREADS=16" FAIL_REGULAR_EXPRESSION "" LABELS "cause_unknown;intermittent_stat_fail;quality_unknown;QMCPACK" PROCESSORS "16" PROCESSOR_AFFINITY "TRUE" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/LiH_solid_1x1x1_pp/short-LiH_solid_1x1x1_hybridrep_pp-x-vmc_hf_noj-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;101;ADD_TEST;/root/repo/CMake/macros.cmake;124;RUN_QMC_APP_NO_COPY;/root/repo/CMake/macros.cmake;167;RUN_QMC_APP;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;53;QMC_RUN_AND_CHECK;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;0;")
+add_test(short-LiH_solid_1x1x1_hybridrep_pp-x-vmc_hf_noj-1-16-kinetic "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "hf_vmc_LiH-x" "-e" "2" "--ke" "7.3772282047321536 0.024")
+set_tests_properties(short-LiH_solid_1x1x1_hybridrep_pp-x-vmc_hf_noj-1-16-kinetic PROPERTIES  DEPENDS "short-LiH_solid_1x1x1_hybridrep_pp-x-vmc_hf_noj-1-16" LABELS "QMCPACK-checking-results;unstable;cause_unknown;intermittent_stat_fail;quality_unknown" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/LiH_solid_1x1x1_pp/short-LiH_solid_1x1x1_hybridrep_pp-x-vmc_hf_noj-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;53;QMC_RUN_AND_CHECK;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;0;")
+add_test(short-LiH_solid_1x1x1_hybridrep_pp-x-vmc_hf_noj-1-16-samples "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "hf_vmc_LiH-x" "-e" "2" "--ts" "1600000 0.0")
+set_tests_properties(short-LiH_solid_1x1x1_hybridrep_pp-x-vmc_hf_noj-1-16-samples PROPERTIES  DEPENDS "short-LiH_solid_1x1x1_hybridrep_pp-x-vmc_hf_noj-1-16" LABELS "QMCPACK-checking-results;unstable;cause_unknown;intermittent_stat_fail;quality_unknown" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/LiH_solid_1x1x1_pp/short-LiH_solid_1x1x1_hybridrep_pp-x-vmc_hf_noj-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;53;QMC_RUN_AND_CHECK;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;0;")
+add_test(short-LiH_solid_1x1x1_hybridrep_pp-x-vmc_hf_noj-1-16-localecp "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "hf_vmc_LiH-x" "-e" "2" "--lpp" "-11.414410381100344 0.025")
+set_tests_properties(short-LiH_solid_1x1x1_hybridrep_pp-x-vmc_hf_noj-1-16-localecp PROPERTIES  DEPENDS "short-LiH_solid_1x1x1_hybridrep_pp-x-vmc_hf_noj-1-16" LABELS "QMCPACK-checking-results;unstable;cause_unknown;intermittent_stat_fail;quality_unknown" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/LiH_solid_1x1x1_pp/short-LiH_solid_1x1x1_hybridrep_pp-x-vmc_hf_noj-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;53;QMC_RUN_AND_CHECK;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;0;")
+add_test(short-LiH_solid_1x1x1_pp-arb-vmc_hf_noj-1-16 "/root/repo/_complex_build/bin/qmcpack" "hf_vmc_LiH-arb.xml")
+set_tests_properties(short-LiH_solid_1x1x1_pp-arb-vmc_hf_noj-1-16 PROPERTIES  ENVIRONMENT "OMP_NUM_THREADS=16" FAIL_REGULAR_EXPRESSION "" LABELS "quality_unknown;QMCPACK" PROCESSORS "16" PROCESSOR_AFFINITY "TRUE" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/LiH_solid_1x1x1_pp/short-LiH_solid_1x1x1_pp-arb-vmc_hf_noj-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;101;ADD_TEST;/root/repo/CMake/macros.cmake;124;RUN_QMC_APP_NO_COPY;/root/repo/CMake/macros.cmake;167;RUN_QMC_APP;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;75;QMC_RUN_AND_CHECK;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;0;")
+add_test(short-LiH_solid_1x1x1_pp-arb-vmc_hf_noj-1-16-kinetic "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "hf_vmc_LiH-arb" "-e" "2" "--ke" "7.4201207734399359 0.024")
+set_tests_properties(short-LiH_solid_1x1x1_pp-arb-vmc_hf_noj-1-16-kinetic PROPERTIES  DEPENDS "short-LiH_solid_1x1x1_pp-arb-vmc_hf_noj-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/LiH_solid_1x1x1_pp/short-LiH_solid_1x1x1_pp-arb-vmc_hf_noj-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;75;QMC_RUN_AND_CHECK;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;0;")
+add_test(short-LiH_solid_1x1x1_pp-arb-vmc_hf_noj-1-16-samples "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "hf_vmc_LiH-arb" "-e" "2" "--ts" "1600000 0.0")
+set_tests_properties(short-LiH_solid_1x1x1_pp-arb-vmc_hf_noj-1-16-samples PROPERTIES  DEPENDS "short-LiH_solid_1x1x1_pp-arb-vmc_hf_noj-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/LiH_solid_1x1x1_pp/short-LiH_solid_1x1x1_pp-arb-vmc_hf_noj-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;75;QMC_RUN_AND_CHECK;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;0;")
+add_test(short-LiH_solid_1x1x1_pp-arb-vmc_hf_noj-1-16-localecp "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "hf_vmc_LiH-arb" "-e" "2" "--lpp" "-11.615276430529056 0.025")
+set_tests_properties(short-LiH_solid_1x1x1_pp-arb-vmc_hf_noj-1-16-localecp PROPERTIES  DEPENDS "short-LiH_solid_1x1x1_pp-arb-vmc_hf_noj-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/LiH_solid_1x1x1_pp/short-LiH_solid_1x1x1_pp-arb-vmc_hf_noj-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;75;QMC_RUN_AND_CHECK;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;0;")
+add_test(short-LiH_solid_1x1x1_pp-arb-drift-vmc_hf_noj-1-16 "/root/repo/_complex_build/bin/qmcpack" "hf_vmc_LiH-arb-drift.xml")
+set_tests_properties(short-LiH_solid_1x1x1_pp-arb-drift-vmc_hf_noj-1-16 PROPERTIES  ENVIRONMENT "OMP_NUM_THREADS=16" FAIL_REGULAR_EXPRESSION "" LABELS "quality_unknown;QMCPACK" PROCESSORS "16" PROCESSOR_AFFINITY "TRUE" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/LiH_solid_1x1x1_pp/short-LiH_solid_1x1x1_pp-arb-drift-vmc_hf_noj-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;101;ADD_TEST;/root/repo/CMake/macros.cmake;124;RUN_QMC_APP_NO_COPY;/root/repo/CMake/macros.cmake;167;RUN_QMC_APP;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;85;QMC_RUN_AND_CHECK;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;0;")
+add_test(short-LiH_solid_1x1x1_pp-arb-drift-vmc_hf_noj-1-16-kinetic "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "hf_vmc_LiH-arb-drift" "-e" "2" "--ke" "7.4201207734399359 0.024")
+set_tests_properties(short-LiH_solid_1x1x1_pp-arb-drift-vmc_hf_noj-1-16-kinetic PROPERTIES  DEPENDS "short-LiH_solid_1x1x1_pp-arb-drift-vmc_hf_noj-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/LiH_solid_1x1x1_pp/short-LiH_solid_1x1x1_pp-arb-drift-vmc_hf_noj-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;85;QMC_RUN_AND_CHECK;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;0;")
+add_test(short-LiH_solid_1x1x1_pp-arb-drift-vmc_hf_noj-1-16-samples "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "hf_vmc_LiH-arb-drift" "-e" "2" "--ts" "1600000 0.0")
+set_tests_properties(short-LiH_solid_1x1x1_pp-arb-drift-vmc_hf_noj-1-16-samples PROPERTIES  DEPENDS "short-LiH_solid_1x1x1_pp-arb-drift-vmc_hf_noj-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/LiH_solid_1x1x1_pp/short-LiH_solid_1x1x1_pp-arb-drift-vmc_hf_noj-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;85;QMC_RUN_AND_CHECK;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;0;")
+add_test(short-LiH_solid_1x1x1_pp-arb-drift-vmc_hf_noj-1-16-localecp "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "hf_vmc_LiH-arb-drift" "-e" "2" "--lpp" "-11.615276430529056 0.025")
+set_tests_properties(short-LiH_solid_1x1x1_pp-arb-drift-vmc_hf_noj-1-16-localecp PROPERTIES  DEPENDS "short-LiH_solid_1x1x1_pp-arb-drift-vmc_hf_noj-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/LiH_solid_1x1x1_pp/short-LiH_solid_1x1x1_pp-arb-drift-vmc_hf_noj-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;85;QMC_RUN_AND_CHECK;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;0;")
+add_test(short-LiH_solid_1x1x1_pp-gamma-vmc_msdj-1-16 "/root/repo/_complex_build/bin/qmcpack" "md_cc_vmc_LiH-gamma.xml")
+set_tests_properties(short-LiH_solid_1x1x1_pp-gamma-vmc_msdj-1-16 PROPERTIES  ENVIRONMENT "OMP_NUM_THREADS=16" FAIL_REGULAR_EXPRESSION "" LABELS "quality_unknown;QMCPACK" PROCESSORS "16" PROCESSOR_AFFINITY "TRUE" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/LiH_solid_1x1x1_pp/short-LiH_solid_1x1x1_pp-gamma-vmc_msdj-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;101;ADD_TEST;/root/repo/CMake/macros.cmake;124;RUN_QMC_APP_NO_COPY;/root/repo/CMake/macros.cmake;167;RUN_QMC_APP;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;97;QMC_RUN_AND_CHECK;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;0;")
+add_test(short-LiH_solid_1x1x1_pp-gamma-vmc_msdj-1-16-totenergy "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "1" "-p" "md_cc_vmc_LiH-gamma" "-e" "2" "--le" "-8.489858484145001 0.004")
+set_tests_properties(short-LiH_solid_1x1x1_pp-gamma-vmc_msdj-1-16-totenergy PROPERTIES  DEPENDS "short-LiH_solid_1x1x1_pp-gamma-vmc_msdj-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/LiH_solid_1x1x1_pp/short-LiH_solid_1x1x1_pp-gamma-vmc_msdj-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;97;QMC_RUN_AND_CHECK;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;0;")
+add_test(short-LiH_solid_1x1x1_pp-gamma-dmc-hf_noj-1-16 "/root/repo/_complex_build/bin/qmcpack" "hf_vmc_dmc_short_LiH-gamma.xml")
+set_tests_properties(short-LiH_solid_1x1x1_pp-gamma-dmc-hf_noj-1-16 PROPERTIES  ENVIRONMENT "OMP_NUM_THREADS=16" FAIL_REGULAR_EXPRESSION "" LABELS "quality_unknown;QMCPACK" PROCESSORS "16" PROCESSOR_AFFINITY "TRUE" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/LiH_solid_1x1x1_pp/short-LiH_solid_1x1x1_pp-gamma-dmc-hf_noj-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;101;ADD_TEST;/root/repo/CMake/macros.cmake;124;RUN_QMC_APP_NO_COPY;/root/repo/CMake/macros.cmake;167;RUN_QMC_APP;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;121;QMC_RUN_AND_CHECK;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;0;")
+add_test(short-LiH_solid_1x1x1_pp-gamma-dmc-hf_noj-1-16-totenergy "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "1" "-p" "hf_vmc_dmc_short_LiH-gamma" "-e" "2" "--le" "-8.54823 0.004")
+set_tests_properties(short-LiH_solid_1x1x1_pp-gamma-dmc-hf_noj-1-16-totenergy PROPERTIES  DEPENDS "short-LiH_solid_1x1x1_pp-gamma-dmc-hf_noj-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/LiH_solid_1x1x1_pp/short-LiH_solid_1x1x1_pp-gamma-dmc-hf_noj-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;121;QMC_RUN_AND_CHECK;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;0;")
+add_test(short-LiH_solid_1x1x1_pp-x-dmc-hf_noj-1-16 "/root/repo/_complex_build/bin/qmcpack" "hf_vmc_dmc_short_LiH-x.xml")
+set_tests_properties(short-LiH_solid_1x1x1_pp-x-dmc-hf_noj-1-16 PROPERTIES  ENVIRONMENT "OMP_NUM_THREADS=16" FAIL_REGULAR_EXPRESSION "" LABELS "quality_unknown;QMCPACK" PROCESSORS "16" PROCESSOR_AFFINITY "TRUE" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/LiH_solid_1x1x1_pp/short-LiH_solid_1x1x1_pp-x-dmc-hf_noj-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;101;ADD_TEST;/root/repo/CMake/macros.cmake;124;RUN_QMC_APP_NO_COPY;/root/repo/CMake/macros.cmake;167;RUN_QMC_APP;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;131;QMC_RUN_AND_CHECK;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;0;")
+add_test(short-LiH_solid_1x1x1_pp-x-dmc-hf_noj-1-16-totenergy "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "1" "-p" "hf_vmc_dmc_short_LiH-x" "-e" "2" "--le" "-8.31413 0.004")
+set_tests_properties(short-LiH_solid_1x1x1_pp-x-dmc-hf_noj-1-16-totenergy PROPERTIES  DEPENDS "short-LiH_solid_1x1x1_pp-x-dmc-hf_noj-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/LiH_solid_1x1x1_pp/short-LiH_solid_1x1x1_pp-x-dmc-hf_noj-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;131;QMC_RUN_AND_CHECK;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;0;")
+add_test(short-LiH_solid_1x1x1_pp-arb-dmc-hf_noj-1-16 "/root/repo/_complex_build/bin/qmcpack" "hf_vmc_dmc_short_LiH-arb.xml")
+set_tests_properties(short-LiH_solid_1x1x1_pp-arb-dmc-hf_noj-1-16 PROPERTIES  ENVIRONMENT "OMP_NUM_THREADS=16" FAIL_REGULAR_EXPRESSION "" LABELS "quality_unknown;QMCPACK" PROCESSORS "16" PROCESSOR_AFFINITY "TRUE" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/LiH_solid_1x1x1_pp/short-LiH_solid_1x1x1_pp-arb-dmc-hf_noj-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;101;ADD_TEST;/root/repo/CMake/macros.cmake;124;RUN_QMC_APP_NO_COPY;/root/repo/CMake/macros.cmake;167;RUN_QMC_APP;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;141;QMC_RUN_AND_CHECK;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;0;")
+add_test(short-LiH_solid_1x1x1_pp-arb-dmc-hf_noj-1-16-totenergy "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "1" "-p" "hf_vmc_dmc_short_LiH-arb" "-e" "2" "--le" "-8.45401 0.004")
+set_tests_properties(short-LiH_solid_1x1x1_pp-arb-dmc-hf_noj-1-16-totenergy PROPERTIES  DEPENDS "short-LiH_solid_1x1x1_pp-arb-dmc-hf_noj-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/LiH_solid_1x1x1_pp/short-LiH_solid_1x1x1_pp-arb-dmc-hf_noj-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;141;QMC_RUN_AND_CHECK;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;0;")
+add_test(short-LiH_solid_1x1x1_pp-gamma-dmcnl-hf_noj-1-16 "/root/repo/_complex_build/bin/qmcpack" "hf_vmc_dmcnl_short_LiH-gamma.xml")
+set_tests_properties(short-LiH_solid_1x1x1_pp-gamma-dmcnl-hf_noj-1-16 PROPERTIES  ENVIRONMENT "OMP_NUM_THREADS=16" FAIL_REGULAR_EXPRESSION "" LABELS "quality_unknown;QMCPACK" PROCESSORS "16" PROCESSOR_AFFINITY "TRUE" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/LiH_solid_1x1x1_pp/short-LiH_solid_1x1x1_pp-gamma-dmcnl-hf_noj-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;101;ADD_TEST;/root/repo/CMake/macros.cmake;124;RUN_QMC_APP_NO_COPY;/root/repo/CMake/macros.cmake;167;RUN_QMC_APP;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;151;QMC_RUN_AND_CHECK;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;0;")
+add_test(short-LiH_solid_1x1x1_pp-gamma-dmcnl-hf_noj-1-16-totenergy "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "1" "-p" "hf_vmc_dmcnl_short_LiH-gamma" "-e" "2" "--le" "-8.54979 0.004")
+set_tests_properties(short-LiH_solid_1x1x1_pp-gamma-dmcnl-hf_noj-1-16-totenergy PROPERTIES  DEPENDS "short-LiH_solid_1x1x1_pp-gamma-dmcnl-hf_noj-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/LiH_solid_1x1x1_pp/short-LiH_solid_1x1x1_pp-gamma-dmcnl-hf_noj-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;151;QMC_RUN_AND_CHECK;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;0;")
+add_test(short-LiH_solid_1x1x1_pp-x-dmcnl-hf_noj-1-16 "/root/repo/_complex_build/bin/qmcpack" "hf_vmc_dmcnl_short_LiH-x.xml")
+set_tests_properties(short-LiH_solid_1x1x1_pp-x-dmcnl-hf_noj-1-16 PROPERTIES  ENVIRONMENT "OMP_NUM_THREADS=16" FAIL_REGULAR_EXPRESSION "" LABELS "cause_unknown;intermittent_stat_fail;quality_unknown;QMCPACK" PROCESSORS "16" PROCESSOR_AFFINITY "TRUE" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/LiH_solid_1x1x1_pp/short-LiH_solid_1x1x1_pp-x-dmcnl-hf_noj-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;101;ADD_TEST;/root/repo/CMake/macros.cmake;124;RUN_QMC_APP_NO_COPY;/root/repo/CMake/macros.cmake;167;RUN_QMC_APP;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;161;QMC_RUN_AND_CHECK;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;0;")
+add_test(short-LiH_solid_1x1x1_pp-x-dmcnl-hf_noj-1-16-totenergy "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "1" "-p" "hf_vmc_dmcnl_short_LiH-x" "-e" "2" "--le" "-8.31369 0.004")
+set_tests_properties(short-LiH_solid_1x1x1_pp-x-dmcnl-hf_noj-1-16-totenergy PROPERTIES  DEPENDS "short-LiH_solid_1x1x1_pp-x-dmcnl-hf_noj-1-16" LABELS "QMCPACK-checking-results;unstable;cause_unknown;intermittent_stat_fail;quality_unknown" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/LiH_solid_1x1x1_pp/short-LiH_solid_1x1x1_pp-x-dmcnl-hf_noj-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;161;QMC_RUN_AND_CHECK;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;0;")
+add_test(short-LiH_solid_1x1x1_pp-arb-dmcnl-hf_noj-1-16 "/root/repo/_complex_build/bin/qmcpack" "hf_vmc_dmcnl_short_LiH-arb.xml")
+set_tests_properties(short-LiH_solid_1x1x1_pp-arb-dmcnl-hf_noj-1-16 PROPERTIES  ENVIRONMENT "OMP_NUM_THREADS=16" FAIL_REGULAR_EXPRESSION "" LABELS "quality_unknown;QMCPACK" PROCESSORS "16" PROCESSOR_AFFINITY "TRUE" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/LiH_solid_1x1x1_pp/short-LiH_solid_1x1x1_pp-arb-dmcnl-hf_noj-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;101;ADD_TEST;/root/repo/CMake/macros.cmake;124;RUN_QMC_APP_NO_COPY;/root/repo/CMake/macros.cmake;167;RUN_QMC_APP;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;171;QMC_RUN_AND_CHECK;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;0;")
+add_test(short-LiH_solid_1x1x1_pp-arb-dmcnl-hf_noj-1-16-totenergy "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "1" "-p" "hf_vmc_dmcnl_short_LiH-arb" "-e" "2" "--le" "-8.45174 0.004")
+set_tests_properties(short-LiH_solid_1x1x1_pp-arb-dmcnl-hf_noj-1-16-totenergy PROPERTIES  DEPENDS "short-LiH_solid_1x1x1_pp-arb-dmcnl-hf_noj-1-16" LABELS "QMCPACK-checking-results;quality_unknown;unstable" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/LiH_solid_1x1x1_pp/short-LiH_solid_1x1x1_pp-arb-dmcnl-hf_noj-1-16" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;171;QMC_RUN_AND_CHECK;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;0;")
+add_test(deterministic-short-LiH_solid_1x1x1_pp-gamma-vmc_hf_noj-1-1 "/root/repo/_complex_build/bin/qmcpack" "det_hf_vmc_LiH-gamma.xml")
+set_tests_properties(deterministic-short-LiH_solid_1x1x1_pp-gamma-vmc_hf_noj-1-1 PROPERTIES  ENVIRONMENT "OMP_NUM_THREADS=1" FAIL_REGULAR_EXPRESSION "" LABELS "quality_unknown;deterministic;QMCPACK" PROCESSORS "1" PROCESSOR_AFFINITY "TRUE" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/LiH_solid_1x1x1_pp/deterministic-short-LiH_solid_1x1x1_pp-gamma-vmc_hf_noj-1-1" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;101;ADD_TEST;/root/repo/CMake/macros.cmake;124;RUN_QMC_APP_NO_COPY;/root/repo/CMake/macros.cmake;167;RUN_QMC_APP;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;223;QMC_RUN_AND_CHECK;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;0;")
+add_test(deterministic-short-LiH_solid_1x1x1_pp-gamma-vmc_hf_noj-1-1-kinetic "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "det_hf_vmc_LiH-gamma" "-e" "2" "--ke" "-0.68365931 0.000001")
+set_tests_properties(deterministic-short-LiH_solid_1x1x1_pp-gamma-vmc_hf_noj-1-1-kinetic PROPERTIES  DEPENDS "deterministic-short-LiH_solid_1x1x1_pp-gamma-vmc_hf_noj-1-1" LABELS "QMCPACK-checking-results;quality_unknown;deterministic" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/LiH_solid_1x1x1_pp/deterministic-short-LiH_solid_1x1x1_pp-gamma-vmc_hf_noj-1-1" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;223;QMC_RUN_AND_CHECK;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;0;")
+add_test(deterministic-short-LiH_solid_1x1x1_pp-gamma-vmc_hf_noj-1-1-totenergy "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "det_hf_vmc_LiH-gamma" "-e" "2" "--le" "-7.87585082 0.000001")
+set_tests_properties(deterministic-short-LiH_solid_1x1x1_pp-gamma-vmc_hf_noj-1-1-totenergy PROPERTIES  DEPENDS "deterministic-short-LiH_solid_1x1x1_pp-gamma-vmc_hf_noj-1-1" LABELS "QMCPACK-checking-results;quality_unknown;deterministic" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/LiH_solid_1x1x1_pp/deterministic-short-LiH_solid_1x1x1_pp-gamma-vmc_hf_noj-1-1" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;223;QMC_RUN_AND_CHECK;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;0;")
+add_test(deterministic-short-LiH_solid_1x1x1_pp-gamma-vmc_hf_noj-1-1-eeenergy "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "det_hf_vmc_LiH-gamma" "-e" "2" "--ee" "-1.75449482 0.000001")
+set_tests_properties(deterministic-short-LiH_solid_1x1x1_pp-gamma-vmc_hf_noj-1-1-eeenergy PROPERTIES  DEPENDS "deterministic-short-LiH_solid_1x1x1_pp-gamma-vmc_hf_noj-1-1" LABELS "QMCPACK-checking-results;quality_unknown;deterministic" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/LiH_solid_1x1x1_pp/deterministic-short-LiH_solid_1x1x1_pp-gamma-vmc_hf_noj-1-1" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;223;QMC_RUN_AND_CHECK;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;0;")
+add_test(deterministic-short-LiH_solid_1x1x1_pp-gamma-vmc_hf_noj-1-1-samples "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "det_hf_vmc_LiH-gamma" "-e" "2" "--ts" "9 0.0")
+set_tests_properties(deterministic-short-LiH_solid_1x1x1_pp-gamma-vmc_hf_noj-1-1-samples PROPERTIES  DEPENDS "deterministic-short-LiH_solid_1x1x1_pp-gamma-vmc_hf_noj-1-1" LABELS "QMCPACK-checking-results;quality_unknown;deterministic" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/LiH_solid_1x1x1_pp/deterministic-short-LiH_solid_1x1x1_pp-gamma-vmc_hf_noj-1-1" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;223;QMC_RUN_AND_CHECK;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;0;")
+add_test(deterministic-short-LiH_solid_1x1x1_pp-gamma-vmc_hf_noj-1-1-potential "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "det_hf_vmc_LiH-gamma" "-e" "2" "--lp" "-7.19219151 0.000001")
+set_tests_properties(deterministic-short-LiH_solid_1x1x1_pp-gamma-vmc_hf_noj-1-1-potential PROPERTIES  DEPENDS "deterministic-short-LiH_solid_1x1x1_pp-gamma-vmc_hf_noj-1-1" LABELS "QMCPACK-checking-results;quality_unknown;deterministic" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/LiH_solid_1x1x1_pp/deterministic-short-LiH_solid_1x1x1_pp-gamma-vmc_hf_noj-1-1" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;223;QMC_RUN_AND_CHECK;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;0;")
+add_test(deterministic-short-LiH_solid_1x1x1_pp-gamma-vmc_hf_noj-1-1-ionion "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "det_hf_vmc_LiH-gamma" "-e" "2" "--ii" "-3.68922683 0.000001")
+set_tests_properties(deterministic-short-LiH_solid_1x1x1_pp-gamma-vmc_hf_noj-1-1-ionion PROPERTIES  DEPENDS "deterministic-short-LiH_solid_1x1x1_pp-gamma-vmc_hf_noj-1-1" LABELS "QMCPACK-checking-results;quality_unknown;deterministic" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/LiH_solid_1x1x1_pp/deterministic-short-LiH_solid_1x1x1_pp-gamma-vmc_hf_noj-1-1" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;223;QMC_RUN_AND_CHECK;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;0;")
+add_test(deterministic-short-LiH_solid_1x1x1_pp-gamma-vmc_hf_noj-1-1-localecp "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "det_hf_vmc_LiH-gamma" "-e" "2" "--lpp" "-1.74846985 0.000001")
+set_tests_properties(deterministic-short-LiH_solid_1x1x1_pp-gamma-vmc_hf_noj-1-1-localecp PROPERTIES  DEPENDS "deterministic-short-LiH_solid_1x1x1_pp-gamma-vmc_hf_noj-1-1" LABELS "QMCPACK-checking-results;quality_unknown;deterministic" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/LiH_solid_1x1x1_pp/deterministic-short-LiH_solid_1x1x1_pp-gamma-vmc_hf_noj-1-1" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;223;QMC_RUN_AND_CHECK;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;0;")
+add_test(deterministic-short-LiH_solid_1x1x1_pp-gamma-vmc_hf_noj-1-1-flux "/root/repo/tests/scripts/check_scalars.py" "--ns" "3" "--series" "0" "-p" "det_hf_vmc_LiH-gamma" "-e" "2" "--fl" "18.03240377 0.000001")
+set_tests_properties(deterministic-short-LiH_solid_1x1x1_pp-gamma-vmc_hf_noj-1-1-flux PROPERTIES  DEPENDS "deterministic-short-LiH_solid_1x1x1_pp-gamma-vmc_hf_noj-1-1" LABELS "QMCPACK-checking-results;quality_unknown;deterministic" WORKING_DIRECTORY "/root/repo/_complex_build/tests/solids/LiH_solid_1x1x1_pp/deterministic-short-LiH_solid_1x1x1_pp-gamma-vmc_hf_noj-1-1" _BACKTRACE_TRIPLES "/root/repo/CMake/macros.cmake;211;ADD_TEST;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;223;QMC_RUN_AND_CHECK;/root/repo/tests/solids/LiH_solid_1x1x1_pp/CMakeLists.txt;0;")
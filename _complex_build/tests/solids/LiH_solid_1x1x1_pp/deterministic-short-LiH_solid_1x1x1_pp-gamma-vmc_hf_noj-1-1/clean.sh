@@ -0,0 +1,3 @@
+#!/bin/sh
+rm -f *.s001.* *.out einspline.tile* *.pp.dat
+
@@ -0,0 +1,3 @@
+#!/bin/sh
+
+rm -rf *.out *.save *.h5 *.bwfn.data* *.wfc* *.wfs.xml *.ptcl.xml 